@@ -6,6 +6,8 @@ LICENSE file in the root directory of this source tree.
 #ifndef __ASTRA_NETWORK_API_HH__
 #define __ASTRA_NETWORK_API_HH__
 
+#include <vector>
+
 #include "astra-sim/system/Common.hh"
 
 namespace AstraSim {
@@ -65,6 +67,32 @@ class AstraNetworkAPI {
         return -1;
     };
 
+    /*
+     * sim_switch_reduce is used for in-network reduction. Every rank in ranks
+     * contributes count bytes, the switch the ranks share reduces the
+     * contributions and multicasts the result back to all of them. Each rank
+     * of the group makes the same call, and msg_handler is triggered on this
+     * rank once the result has arrived. Backends that cannot reduce in the
+     * network return -1.
+     */
+    virtual int sim_switch_reduce(uint64_t count,
+                                  const std::vector<int>& ranks,
+                                  int tag,
+                                  void (*msg_handler)(void* fun_arg),
+                                  void* fun_arg) {
+        return -1;
+    };
+
+    /*
+     * sim_closed_form_send_delay returns the delay, in ns, of a message of
+     * count bytes from this rank to dst for backends that compute message
+     * delays in closed form, without modelling congestion. Backends that have
+     * to simulate the message return -1.
+     */
+    virtual double sim_closed_form_send_delay(int dst, uint64_t count) {
+        return -1;
+    };
+
     // Notifies that the workload for this rank has finished. 
     // Note that we have one network handler per rank. 
     // Therefore, when implementing this function, the network handler must 
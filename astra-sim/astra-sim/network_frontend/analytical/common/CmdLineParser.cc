@@ -38,6 +38,12 @@ void CmdLineParser::define_options() noexcept {
         "injection-scale", "Injection scale",
         cxxopts::value<double>()->default_value("1"))(
         "rendezvous-protocol", "Whether to enable rendezvous protocol",
+        cxxopts::value<bool>()->default_value("false"))(
+        "rank-placement-configuration",
+        "Rank placement file, mapping each rank to an NPU",
+        cxxopts::value<std::string>()->default_value("empty"))(
+        "optimize-rank-placement",
+        "Whether to place the ranks to minimize their weighted hop count",
         cxxopts::value<bool>()->default_value("false"));
 }
 
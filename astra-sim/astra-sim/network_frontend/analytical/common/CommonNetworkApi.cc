@@ -20,6 +20,8 @@ int CommonNetworkApi::dims_count = -1;
 
 std::vector<Bandwidth> CommonNetworkApi::bandwidth_per_dim = {};
 
+std::vector<int> CommonNetworkApi::rank_placement = {};
+
 void CommonNetworkApi::set_event_queue(
     std::shared_ptr<EventQueue> event_queue_ptr) noexcept {
     assert(event_queue_ptr != nullptr);
@@ -27,6 +29,11 @@ void CommonNetworkApi::set_event_queue(
     CommonNetworkApi::event_queue = std::move(event_queue_ptr);
 }
 
+void CommonNetworkApi::set_rank_placement(
+    std::vector<int> placement) noexcept {
+    CommonNetworkApi::rank_placement = std::move(placement);
+}
+
 CallbackTracker& CommonNetworkApi::get_callback_tracker() noexcept {
     return callback_tracker;
 }
@@ -137,6 +144,16 @@ int CommonNetworkApi::sim_recv(void* const buffer,
     return 0;
 }
 
+DeviceId CommonNetworkApi::get_npu(const int rank) noexcept {
+    assert(rank >= 0);
+
+    if (rank_placement.empty()) {
+        return rank;
+    }
+    assert(rank < static_cast<int>(rank_placement.size()));
+    return rank_placement[rank];
+}
+
 double CommonNetworkApi::get_BW_at_dimension(const int dim) {
     assert(0 <= dim && dim < dims_count);
 
@@ -0,0 +1,313 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#include "common/RankPlacement.hh"
+#include "astra-sim/common/Logging.hh"
+#include "extern/graph_frontend/chakra/src/feeder/et_feeder.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <json/json.hpp>
+#include <limits>
+
+using namespace AstraSimAnalytical;
+using json = nlohmann::json;
+
+typedef ChakraProtoMsg::NodeType ChakraNodeType;
+
+std::vector<int> RankPlacement::read(const std::string& path,
+                                     const int npus_count) noexcept {
+    assert(npus_count > 0);
+
+    auto placement_file = std::ifstream(path);
+    if (!placement_file) {
+        std::cerr << "[Error] (AstraSim/analytical/common) "
+                  << "failed to open rank placement file " << path
+                  << std::endl;
+        std::exit(-1);
+    }
+
+    auto placement = std::vector<int>();
+    try {
+        const auto j = json::parse(placement_file);
+        placement = j.get<std::vector<int>>();
+    } catch (const json::exception& e) {
+        std::cerr << "[Error] (AstraSim/analytical/common) "
+                  << "failed to parse rank placement file " << path << ": "
+                  << e.what() << std::endl;
+        std::exit(-1);
+    }
+
+    // the placement must be a permutation of the NPUs
+    if (static_cast<int>(placement.size()) != npus_count) {
+        std::cerr << "[Error] (AstraSim/analytical/common) "
+                  << "rank placement places " << placement.size()
+                  << " ranks on " << npus_count << " NPUs" << std::endl;
+        std::exit(-1);
+    }
+    auto npu_used = std::vector<bool>(npus_count, false);
+    for (auto rank = 0; rank < npus_count; rank++) {
+        const auto npu = placement[rank];
+        if (npu < 0 || npu >= npus_count || npu_used[npu]) {
+            std::cerr << "[Error] (AstraSim/analytical/common) "
+                      << "rank placement places rank " << rank
+                      << " on invalid or already used NPU " << npu
+                      << std::endl;
+            std::exit(-1);
+        }
+        npu_used[npu] = true;
+    }
+
+    return placement;
+}
+
+std::vector<int> RankPlacement::optimize(
+    const std::string& workload_configuration,
+    const std::string& comm_group_configuration,
+    const std::vector<int>& npus_count_per_dim,
+    const HopsCount& hops_count) noexcept {
+    auto npus_count = 1;
+    for (const auto count : npus_count_per_dim) {
+        npus_count *= count;
+    }
+
+    // the greedy placement is quadratic in the NPUs at least
+    auto logger = AstraSim::LoggerFactory::get_logger("network");
+    if (npus_count > max_optimized_npus_count) {
+        logger->warn("rank placement is not optimized beyond {} NPUs, "
+                     "keeping the identity placement of {} NPUs",
+                     max_optimized_npus_count, npus_count);
+        auto identity = std::vector<int>(npus_count);
+        for (auto rank = 0; rank < npus_count; rank++) {
+            identity[rank] = rank;
+        }
+        return identity;
+    }
+
+    const auto traffic = read_traffic(
+        workload_configuration, comm_group_configuration, npus_count_per_dim);
+    assert(static_cast<int>(traffic.size()) == npus_count);
+
+    // hops between every pair of NPUs
+    auto hops = std::vector<std::vector<int>>(npus_count,
+                                              std::vector<int>(npus_count, 0));
+    for (auto src = 0; src < npus_count; src++) {
+        for (auto dest = 0; dest < npus_count; dest++) {
+            if (src != dest) {
+                hops[src][dest] = hops_count(src, dest);
+            }
+        }
+    }
+
+    auto total_traffic = std::vector<double>(npus_count, 0);
+    for (auto rank = 0; rank < npus_count; rank++) {
+        for (const auto& [peer, bytes] : traffic[rank]) {
+            total_traffic[rank] += bytes;
+        }
+    }
+
+    auto placement = std::vector<int>(npus_count, -1);
+    auto npu_used = std::vector<bool>(npus_count, false);
+    auto placed_traffic = std::vector<double>(npus_count, 0);
+    for (auto step = 0; step < npus_count; step++) {
+        // place the rank talking the most to the placed ones next,
+        // and the busiest one if none of them talks to the placed ones
+        auto rank = -1;
+        for (auto candidate = 0; candidate < npus_count; candidate++) {
+            if (placement[candidate] >= 0) {
+                continue;
+            }
+            if (rank < 0 ||
+                placed_traffic[candidate] > placed_traffic[rank] ||
+                (placed_traffic[candidate] == placed_traffic[rank] &&
+                 total_traffic[candidate] > total_traffic[rank])) {
+                rank = candidate;
+            }
+        }
+
+        // choose the free NPU closest to the placed peers
+        auto best_npu = -1;
+        auto best_cost = std::numeric_limits<double>::max();
+        for (auto npu = 0; npu < npus_count; npu++) {
+            if (npu_used[npu]) {
+                continue;
+            }
+            auto cost = 0.0;
+            for (const auto& [peer, bytes] : traffic[rank]) {
+                if (placement[peer] >= 0) {
+                    cost += bytes * hops[npu][placement[peer]];
+                }
+            }
+            if (cost < best_cost) {
+                best_npu = npu;
+                best_cost = cost;
+            }
+        }
+
+        placement[rank] = best_npu;
+        npu_used[best_npu] = true;
+        for (const auto& [peer, bytes] : traffic[rank]) {
+            placed_traffic[peer] += bytes;
+        }
+    }
+
+    // keep the identity placement unless the greedy one improves on it
+    auto identity = std::vector<int>(npus_count);
+    for (auto rank = 0; rank < npus_count; rank++) {
+        identity[rank] = rank;
+    }
+    const auto cost = compute_cost(traffic, placement, hops);
+    const auto identity_cost = compute_cost(traffic, identity, hops);
+    if (cost >= identity_cost) {
+        placement = identity;
+    }
+
+    logger->info("rank placement weighted hop count {:.0f} (identity {:.0f})",
+                 std::min(cost, identity_cost), identity_cost);
+    for (auto rank = 0; rank < npus_count; rank++) {
+        logger->debug("rank {} placed on NPU {}", rank, placement[rank]);
+    }
+
+    return placement;
+}
+
+RankPlacement::Traffic RankPlacement::read_traffic(
+    const std::string& workload_configuration,
+    const std::string& comm_group_configuration,
+    const std::vector<int>& npus_count_per_dim) noexcept {
+    auto npus_count = 1;
+    for (const auto count : npus_count_per_dim) {
+        npus_count *= count;
+    }
+    const auto dims_count = static_cast<int>(npus_count_per_dim.size());
+    const auto comm_groups =
+        read_comm_groups(comm_group_configuration, npus_count);
+
+    auto traffic = Traffic(npus_count);
+    const auto add_traffic = [&traffic](const int src, const int dest,
+                                        const double bytes) {
+        if (src != dest) {
+            traffic[src][dest] += bytes;
+            traffic[dest][src] += bytes;
+        }
+    };
+
+    for (auto rank = 0; rank < npus_count; rank++) {
+        const auto trace_path =
+            workload_configuration + "." + std::to_string(rank) + ".et";
+        if (!std::ifstream(trace_path)) {
+            std::cerr << "[Error] (AstraSim/analytical/common) "
+                      << "workload file: " << trace_path << " does not exist"
+                      << std::endl;
+            std::exit(-1);
+        }
+        auto et_feeder = Chakra::ETFeeder(trace_path);
+
+        // walk the trace in dependency order
+        while (et_feeder.hasNodesToIssue()) {
+            const auto node = et_feeder.getNextIssuableNode();
+            if (node == nullptr) {
+                break;
+            }
+
+            if (!node->is_cpu_op() &&
+                node->type() == ChakraNodeType::COMM_SEND_NODE) {
+                add_traffic(rank, static_cast<int>(node->comm_dst()),
+                            static_cast<double>(node->comm_size()));
+            } else if (!node->is_cpu_op() &&
+                       node->type() == ChakraNodeType::COMM_COLL_NODE) {
+                const auto bytes = static_cast<double>(node->comm_size());
+                const auto& comm_group = comm_groups[rank];
+                if (!comm_group.empty()) {
+                    // every other member of the group
+                    for (const auto peer : comm_group) {
+                        add_traffic(rank, peer,
+                                    bytes / (comm_group.size() - 1));
+                    }
+                } else {
+                    // the ranks along each involved dimension, one after
+                    // another
+                    auto involved_dim = std::vector<bool>(dims_count, true);
+                    if (node->has_other_attr("involved_dim")) {
+                        const auto& bool_list =
+                            node->get_other_attr("involved_dim").bool_list();
+                        for (auto dim = 0; dim < dims_count; dim++) {
+                            involved_dim[dim] = dim < bool_list.values_size() &&
+                                                bool_list.values(dim);
+                        }
+                    }
+
+                    auto stride = 1;
+                    for (auto dim = 0; dim < dims_count; dim++) {
+                        const auto count = npus_count_per_dim[dim];
+                        if (involved_dim[dim] && count > 1) {
+                            const auto base =
+                                rank - ((rank / stride) % count) * stride;
+                            for (auto i = 0; i < count; i++) {
+                                add_traffic(rank, base + (i * stride),
+                                            bytes / (count - 1));
+                            }
+                        }
+                        stride *= count;
+                    }
+                }
+            }
+
+            et_feeder.freeChildrenNodes(node->id());
+            et_feeder.removeNode(node->id());
+        }
+    }
+
+    return traffic;
+}
+
+std::vector<std::vector<int>> RankPlacement::read_comm_groups(
+    const std::string& comm_group_configuration,
+    const int npus_count) noexcept {
+    auto comm_groups = std::vector<std::vector<int>>(npus_count);
+
+    // communicator group input file is not given
+    if (comm_group_configuration.find("empty") != std::string::npos) {
+        return comm_groups;
+    }
+
+    auto comm_group_file = std::ifstream(comm_group_configuration);
+    if (!comm_group_file) {
+        std::cerr << "[Error] (AstraSim/analytical/common) "
+                  << "failed to open communicator group file "
+                  << comm_group_configuration << std::endl;
+        std::exit(-1);
+    }
+    json j;
+    comm_group_file >> j;
+
+    for (json::iterator it = j.begin(); it != j.end(); ++it) {
+        const auto members = it.value().get<std::vector<int>>();
+        for (const auto member : members) {
+            if (0 <= member && member < npus_count) {
+                comm_groups[member] = members;
+            }
+        }
+    }
+
+    return comm_groups;
+}
+
+double RankPlacement::compute_cost(
+    const Traffic& traffic,
+    const std::vector<int>& placement,
+    const std::vector<std::vector<int>>& hops) noexcept {
+    auto cost = 0.0;
+    for (auto rank = 0; rank < static_cast<int>(traffic.size()); rank++) {
+        for (const auto& [peer, bytes] : traffic[rank]) {
+            cost += bytes * hops[placement[rank]][placement[peer]];
+        }
+    }
+
+    // every pair is counted from both ends
+    return cost / 2;
+}
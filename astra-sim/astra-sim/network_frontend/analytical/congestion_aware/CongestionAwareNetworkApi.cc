@@ -14,6 +14,9 @@ using namespace NetworkAnalyticalCongestionAware;
 
 std::shared_ptr<Topology> CongestionAwareNetworkApi::topology;
 
+CongestionAwareNetworkApi::SwitchReductions
+    CongestionAwareNetworkApi::switch_reductions;
+
 void CongestionAwareNetworkApi::set_topology(
     std::shared_ptr<Topology> topology_ptr) noexcept {
     assert(topology_ptr != nullptr);
@@ -62,18 +65,121 @@ int CongestionAwareNetworkApi::sim_send(void* const buffer,
         new_entry->register_send_callback(msg_handler, fun_arg);
     }
 
-    // create chunk
+    // create chunk arrival argument
     auto chunk_arrival_arg = std::tuple(tag, src, dst, count, chunk_id);
     auto arg = std::make_unique<decltype(chunk_arrival_arg)>(chunk_arrival_arg);
     const auto arg_ptr = static_cast<void*>(arg.release());
-    const auto route = topology->route(src, dst);
+
+    // initiate transmission from src -> dst, each tag is a flow of its own
+    topology->send(get_npu(src), get_npu(dst), count,
+                   CongestionAwareNetworkApi::process_chunk_arrival, arg_ptr,
+                   tag, chunk_id);
+
+    // return
+    return 0;
+}
+
+int CongestionAwareNetworkApi::sim_switch_reduce(const uint64_t count,
+                                                 const std::vector<int>& ranks,
+                                                 const int tag,
+                                                 void (*msg_handler)(void*),
+                                                 void* const fun_arg) {
+    const auto src = sim_comm_get_rank();
+    if (ranks.size() < 2) {
+        return -1;
+    }
+
+    // the ranks must reach each other through exactly one switch
+    const auto peer = ranks.at(0) == src ? ranks.at(1) : ranks.at(0);
+    auto route = topology->route(get_npu(src), get_npu(peer));
+    if (route.size() != 3) {
+        return -1;
+    }
+    route.pop_back();
+    const auto switch_device = route.back();
+    if (switch_device->get_id() < topology->get_npus_count()) {
+        return -1;
+    }
+
+    // find the reduction this call joins
+    const auto entry =
+        switch_reductions.try_emplace(std::tuple(tag, count, ranks)).first;
+    auto& group = entry->second;
+    if (group.ranks_count == 0) {
+        group.switch_device = switch_device;
+        group.ranks_count = static_cast<int>(ranks.size());
+        group.count = count;
+    } else if (group.switch_device != switch_device) {
+        return -1;
+    }
+    const auto index = group.issued[src]++;
+    assert(index >= group.first_index);
+    while (group.first_index + group.reductions.size() <= index) {
+        group.reductions.emplace_back();
+    }
+    group.reductions.at(index - group.first_index)
+        .members.emplace_back(route.front(), msg_handler, fun_arg);
+
+    // send the contribution to the switch
+    auto arrival_arg = std::tuple(entry, index);
+    auto arg = std::make_unique<decltype(arrival_arg)>(arrival_arg);
+    const auto arg_ptr = static_cast<void*>(arg.release());
     auto chunk = std::make_unique<Chunk>(
-        count, route, CongestionAwareNetworkApi::process_chunk_arrival,
+        count, route, CongestionAwareNetworkApi::process_switch_arrival,
         arg_ptr);
-
-    // initiate transmission from src -> dst.
     topology->send(std::move(chunk));
 
-    // return
     return 0;
 }
+
+void CongestionAwareNetworkApi::process_switch_arrival(void* args) noexcept {
+    assert(args != nullptr);
+
+    // parse arrival data
+    auto* const data =
+        static_cast<std::tuple<SwitchReductions::iterator, uint64_t>*>(args);
+    const auto [entry, index] = *data;
+    delete data;
+
+    auto* const group = &entry->second;
+    auto& reduction = group->reductions.at(index - group->first_index);
+    reduction.arrived++;
+    if (reduction.arrived < group->ranks_count) {
+        return;
+    }
+
+    // every contribution arrived, multicast the result to the ranks
+    for (const auto& [device, msg_handler, fun_arg] : reduction.members) {
+        auto multicast_arg = std::tuple(msg_handler, fun_arg);
+        auto arg = std::make_unique<decltype(multicast_arg)>(multicast_arg);
+        const auto arg_ptr = static_cast<void*>(arg.release());
+        auto chunk = std::make_unique<Chunk>(
+            group->count, Route{group->switch_device, device},
+            CongestionAwareNetworkApi::process_multicast_arrival, arg_ptr);
+        topology->send(std::move(chunk));
+    }
+
+    // drop the reductions that have been multicast
+    while (!group->reductions.empty() &&
+           group->reductions.front().arrived == group->ranks_count) {
+        group->reductions.pop_front();
+        group->first_index++;
+    }
+
+    // every rank's contributions have been multicast,
+    // so the next call of each rank starts the group over
+    if (group->reductions.empty()) {
+        switch_reductions.erase(entry);
+    }
+}
+
+void CongestionAwareNetworkApi::process_multicast_arrival(void* args) noexcept {
+    assert(args != nullptr);
+
+    // parse arrival data
+    auto* const data = static_cast<std::tuple<void (*)(void*), void*>*>(args);
+    const auto [msg_handler, fun_arg] = *data;
+    delete data;
+
+    (*msg_handler)(fun_arg);
+}
@@ -5,10 +5,12 @@ LICENSE file in the root directory of this source tree.
 
 #include "astra-sim/common/Logging.hh"
 #include "common/CmdLineParser.hh"
+#include "common/RankPlacement.hh"
 #include "congestion_aware/CongestionAwareNetworkApi.hh"
 #include <astra-network-analytical/common/EventQueue.h>
 #include <astra-network-analytical/common/NetworkParser.h>
 #include <astra-network-analytical/congestion_aware/Helper.h>
+#include <fstream>
 #include <remote_memory_backend/analytical/AnalyticalRemoteMemory.hh>
 
 using namespace AstraSim;
@@ -42,6 +44,10 @@ int main(int argc, char* argv[]) {
     const auto injection_scale = cmd_line_parser.get<double>("injection-scale");
     const auto rendezvous_protocol =
         cmd_line_parser.get<bool>("rendezvous-protocol");
+    const auto rank_placement_configuration =
+        cmd_line_parser.get<std::string>("rank-placement-configuration");
+    const auto optimize_rank_placement =
+        cmd_line_parser.get<bool>("optimize-rank-placement");
 
     AstraSim::LoggerFactory::init(logging_configuration);
 
@@ -62,6 +68,25 @@ int main(int argc, char* argv[]) {
     CongestionAwareNetworkApi::set_event_queue(event_queue);
     CongestionAwareNetworkApi::set_topology(topology);
 
+    // Map the ranks onto the NPUs of the topology
+    if (rank_placement_configuration != "empty") {
+        if (optimize_rank_placement) {
+            std::cerr << "[Error] (AstraSim/analytical/congestion_aware) "
+                      << "rank placement is both given and optimized"
+                      << std::endl;
+            std::exit(-1);
+        }
+        CongestionAwareNetworkApi::set_rank_placement(
+            RankPlacement::read(rank_placement_configuration, npus_count));
+    } else if (optimize_rank_placement) {
+        const auto hops_count = [&topology](const int src, const int dest) {
+            return topology->get_hops_count(src, dest);
+        };
+        CongestionAwareNetworkApi::set_rank_placement(RankPlacement::optimize(
+            workload_configuration, comm_group_configuration,
+            npus_count_per_dim, hops_count));
+    }
+
     // Create ASTRA-sim related resources
     auto network_apis =
         std::vector<std::unique_ptr<CongestionAwareNetworkApi>>();
@@ -98,6 +123,29 @@ int main(int argc, char* argv[]) {
         event_queue->proceed();
     }
 
+    // chunks left behind can only be blocked by full link buffers
+    const auto pending_chunks_count = topology->get_pending_chunks_count();
+    if (pending_chunks_count > 0) {
+        std::cerr << "[Error] (AstraSim/analytical/congestion_aware) "
+                  << "network deadlocked with " << pending_chunks_count
+                  << " chunks blocked by full link buffers" << std::endl;
+        std::exit(-1);
+    }
+
+    // dump per-link counters
+    const auto link_telemetry_path = network_parser.get_link_telemetry_path();
+    if (!link_telemetry_path.empty()) {
+        auto link_telemetry = std::ofstream(link_telemetry_path);
+        if (!link_telemetry) {
+            std::cerr << "[Error] (AstraSim/analytical/congestion_aware) "
+                      << "failed to open link telemetry file "
+                      << link_telemetry_path << std::endl;
+            std::exit(-1);
+        }
+        topology->dump_link_telemetry(link_telemetry,
+                                      event_queue->get_current_time());
+    }
+
     // terminate simulation
     AstraSim::LoggerFactory::shutdown();
     return 0;
@@ -68,7 +68,9 @@ int CongestionUnawareNetworkApi::sim_send(void* const buffer,
     const auto arg_ptr = static_cast<void*>(arg.release());
 
     // compute send communication delay (in AstraSim format)
-    const auto send_delay_ns = topology->send(src, dst, count);
+    const auto current_time = event_queue->get_current_time();
+    const auto send_delay_ns =
+        topology->send_at(get_npu(src), get_npu(dst), count, current_time);
     const auto send_delay = static_cast<double>(send_delay_ns);
     const auto delta = timespec_t({NS, send_delay});
 
@@ -79,3 +81,15 @@ int CongestionUnawareNetworkApi::sim_send(void* const buffer,
     // return
     return 0;
 }
+
+double CongestionUnawareNetworkApi::sim_closed_form_send_delay(
+    const int dst, const uint64_t count) {
+    // the delay depends on the concurrent transfers
+    if (topology->is_contention_modeled()) {
+        return -1;
+    }
+
+    const auto src = sim_comm_get_rank();
+    return static_cast<double>(
+        topology->send(get_npu(src), get_npu(dst), count));
+}
@@ -5,6 +5,7 @@ LICENSE file in the root directory of this source tree.
 
 #include "astra-sim/common/Logging.hh"
 #include "common/CmdLineParser.hh"
+#include "common/RankPlacement.hh"
 #include "congestion_unaware/CongestionUnawareNetworkApi.hh"
 #include <astra-network-analytical/common/EventQueue.h>
 #include <astra-network-analytical/common/NetworkParser.h>
@@ -42,6 +43,10 @@ int main(int argc, char* argv[]) {
     const auto injection_scale = cmd_line_parser.get<double>("injection-scale");
     const auto rendezvous_protocol =
         cmd_line_parser.get<bool>("rendezvous-protocol");
+    const auto rank_placement_configuration =
+        cmd_line_parser.get<std::string>("rank-placement-configuration");
+    const auto optimize_rank_placement =
+        cmd_line_parser.get<bool>("optimize-rank-placement");
 
     AstraSim::LoggerFactory::init(logging_configuration);
 
@@ -61,6 +66,25 @@ int main(int argc, char* argv[]) {
     CongestionUnawareNetworkApi::set_event_queue(event_queue);
     CongestionUnawareNetworkApi::set_topology(topology);
 
+    // Map the ranks onto the NPUs of the topology
+    if (rank_placement_configuration != "empty") {
+        if (optimize_rank_placement) {
+            std::cerr << "[Error] (AstraSim/analytical/congestion_unaware) "
+                      << "rank placement is both given and optimized"
+                      << std::endl;
+            std::exit(-1);
+        }
+        CongestionUnawareNetworkApi::set_rank_placement(
+            RankPlacement::read(rank_placement_configuration, npus_count));
+    } else if (optimize_rank_placement) {
+        const auto hops_count = [&topology](const int src, const int dest) {
+            return topology->get_hops_count(src, dest);
+        };
+        CongestionUnawareNetworkApi::set_rank_placement(RankPlacement::optimize(
+            workload_configuration, comm_group_configuration,
+            npus_count_per_dim, hops_count));
+    }
+
     // Create ASTRA-sim related resources
     auto network_apis =
         std::vector<std::unique_ptr<CongestionUnawareNetworkApi>>();
@@ -33,6 +33,13 @@ class CommonNetworkApi : public AstraNetworkAPI {
     static void set_event_queue(
         std::shared_ptr<EventQueue> event_queue_ptr) noexcept;
 
+    /**
+     * Set the NPU each rank runs on, where rank i runs on NPU i if not set.
+     *
+     * @param placement NPU of each rank
+     */
+    static void set_rank_placement(std::vector<int> placement) noexcept;
+
     /**
      * Get the reference to the callback tracker.
      *
@@ -98,6 +105,17 @@ class CommonNetworkApi : public AstraNetworkAPI {
 
     /// number of network dimensions of the topology
     static int dims_count;
+
+    /// NPU each rank runs on, empty if rank i runs on NPU i
+    static std::vector<int> rank_placement;
+
+    /**
+     * Get the NPU the given rank runs on.
+     *
+     * @param rank rank to look up
+     * @return NPU ID of the rank in the topology
+     */
+    [[nodiscard]] static DeviceId get_npu(int rank) noexcept;
 };
 
 }  // namespace AstraSimAnalytical
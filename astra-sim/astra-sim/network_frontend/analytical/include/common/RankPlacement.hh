@@ -0,0 +1,108 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace AstraSimAnalytical {
+
+/**
+ * RankPlacement maps the logical ranks of the workload onto the NPUs of the
+ * network topology, where placement[rank] is the NPU the rank runs on.
+ * Without a placement, rank i runs on NPU i.
+ */
+class RankPlacement {
+  public:
+    /// number of hops between two NPUs, given as (src, dest)
+    using HopsCount = std::function<int(int, int)>;
+
+    /**
+     * Read the placement from a JSON file,
+     * an array whose i-th element is the NPU of rank i.
+     *
+     * @param path path of the JSON file
+     * @param npus_count number of NPUs of the topology
+     * @return NPU of each rank
+     */
+    [[nodiscard]] static std::vector<int> read(const std::string& path,
+                                               int npus_count) noexcept;
+
+    /// largest number of NPUs optimize() places
+    static constexpr int max_optimized_npus_count = 4096;
+
+    /**
+     * Greedily place the ranks to minimize the hop count weighted by the
+     * bytes each pair of ranks exchanges, as found in the execution traces.
+     * Falls back to the identity placement if that one is cheaper.
+     *
+     * The hops between every pair of NPUs are counted once, and each rank
+     * weighs every free NPU against its peers, so the cost grows as
+     * npus_count^2 * peers per rank. Beyond max_optimized_npus_count NPUs,
+     * the identity placement is kept without reading the traces.
+     *
+     * @param workload_configuration prefix of the execution traces
+     * @param comm_group_configuration communicator group file, or "empty"
+     * @param npus_count_per_dim number of NPUs per network dimension
+     * @param hops_count number of hops between two NPUs, which should be
+     * cheap as it's called for every pair of NPUs
+     * @return NPU of each rank
+     */
+    [[nodiscard]] static std::vector<int> optimize(
+        const std::string& workload_configuration,
+        const std::string& comm_group_configuration,
+        const std::vector<int>& npus_count_per_dim,
+        const HopsCount& hops_count) noexcept;
+
+  private:
+    /// bytes exchanged with each peer rank, per rank
+    using Traffic = std::vector<std::map<int, double>>;
+
+    /**
+     * Collect the bytes each pair of ranks exchanges from the execution
+     * traces. A collective spreads its size evenly over the peers it talks
+     * to: the other members of the communicator group, or otherwise the ranks
+     * differing in a single involved dimension. Point-to-point sends add their
+     * size to the destination.
+     *
+     * @param workload_configuration prefix of the execution traces
+     * @param comm_group_configuration communicator group file, or "empty"
+     * @param npus_count_per_dim number of NPUs per network dimension
+     * @return symmetric traffic between the ranks
+     */
+    [[nodiscard]] static Traffic read_traffic(
+        const std::string& workload_configuration,
+        const std::string& comm_group_configuration,
+        const std::vector<int>& npus_count_per_dim) noexcept;
+
+    /**
+     * Read the communicator group of each rank, which is the last group
+     * the rank is listed in.
+     *
+     * @param comm_group_configuration communicator group file, or "empty"
+     * @param npus_count number of ranks
+     * @return members of the communicator group of each rank, empty if none
+     */
+    [[nodiscard]] static std::vector<std::vector<int>> read_comm_groups(
+        const std::string& comm_group_configuration, int npus_count) noexcept;
+
+    /**
+     * Compute the weighted hop count of a placement.
+     *
+     * @param traffic traffic between the ranks
+     * @param placement NPU of each rank
+     * @param hops number of hops between each pair of NPUs
+     * @return sum of bytes times hops over all pairs of ranks
+     */
+    [[nodiscard]] static double compute_cost(
+        const Traffic& traffic,
+        const std::vector<int>& placement,
+        const std::vector<std::vector<int>>& hops) noexcept;
+};
+
+}  // namespace AstraSimAnalytical
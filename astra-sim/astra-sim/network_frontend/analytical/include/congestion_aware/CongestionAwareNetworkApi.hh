@@ -7,6 +7,10 @@ LICENSE file in the root directory of this source tree.
 
 #include "common/CommonNetworkApi.hh"
 #include <astra-network-analytical/congestion_aware/Topology.h>
+#include <deque>
+#include <map>
+#include <tuple>
+#include <vector>
 
 using namespace AstraSim;
 using namespace AstraSimAnalytical;
@@ -43,9 +47,80 @@ class CongestionAwareNetworkApi final : public CommonNetworkApi {
                  void (*msg_handler)(void* fun_arg),
                  void* fun_arg) override;
 
+    /**
+     * Implement sim_switch_reduce of AstraNetworkAPI.
+     * Every rank sends its data to the switch the ranks share. Once the
+     * switch has received all contributions, it multicasts the reduced data
+     * back to every rank. Returns -1 if the ranks do not share a switch.
+     */
+    int sim_switch_reduce(uint64_t count,
+                          const std::vector<int>& ranks,
+                          int tag,
+                          void (*msg_handler)(void* fun_arg),
+                          void* fun_arg) override;
+
   private:
+    /**
+     * One in-network reduction, waiting for the contributions of its ranks.
+     */
+    struct SwitchReduction {
+        /// number of contributions that arrived at the switch
+        int arrived = 0;
+
+        /// (device, msg_handler, fun_arg) of every rank that joined
+        std::vector<std::tuple<std::shared_ptr<Device>, void (*)(void*), void*>>
+            members;
+    };
+
+    /**
+     * The in-network reductions of one group of ranks, in issue order.
+     * The n-th call of a rank joins the n-th reduction of the group.
+     */
+    struct SwitchReductionGroup {
+        /// switch the ranks of the group are attached to
+        std::shared_ptr<Device> switch_device;
+
+        /// number of ranks in the group
+        int ranks_count = 0;
+
+        /// size of the data each rank contributes
+        uint64_t count = 0;
+
+        /// reductions that have not been multicast yet
+        std::deque<SwitchReduction> reductions;
+
+        /// index of the first reduction in reductions
+        uint64_t first_index = 0;
+
+        /// number of calls each rank has issued
+        std::map<int, uint64_t> issued;
+    };
+
+    /// in-network reductions per (tag, count, ranks)
+    using SwitchReductions =
+        std::map<std::tuple<int, uint64_t, std::vector<int>>,
+                 SwitchReductionGroup>;
+
+    /**
+     * Callback to be invoked when a contribution arrives at the switch.
+     *
+     * @param args (group entry, reduction index) of the contribution
+     */
+    static void process_switch_arrival(void* args) noexcept;
+
+    /**
+     * Callback to be invoked when the reduced data arrives at a rank.
+     *
+     * @param args (msg_handler, fun_arg) of the rank
+     */
+    static void process_multicast_arrival(void* args) noexcept;
+
     /// topology
     static std::shared_ptr<Topology> topology;
+
+    /// in-network reductions per (tag, count, ranks),
+    /// a group is dropped once all its reductions have been multicast
+    static SwitchReductions switch_reductions;
 };
 
 }  // namespace AstraSimAnalyticalCongestionAware
@@ -49,6 +49,13 @@ class CongestionUnawareNetworkApi final : public CommonNetworkApi {
                  void (*msg_handler)(void* fun_arg),
                  void* fun_arg) override;
 
+    /**
+     * Implement sim_closed_form_send_delay of AstraNetworkAPI.
+     * The congestion_unaware backend computes every message delay in closed
+     * form, unless its contention model is enabled.
+     */
+    double sim_closed_form_send_delay(int dst, uint64_t count) override;
+
   private:
     /// topology
     static std::shared_ptr<Topology> topology;
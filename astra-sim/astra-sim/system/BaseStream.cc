@@ -23,12 +23,12 @@ BaseStream::BaseStream(int stream_id,
     this->stream_id = stream_id;
     this->owner = owner;
     this->initialized = false;
+    this->waiting_queue = nullptr;
     this->phases_to_go = phases_to_go;
     if (synchronizer.find(stream_id) != synchronizer.end()) {
         synchronizer[stream_id]++;
     } else {
         synchronizer[stream_id] = 1;
-        ready_counter[stream_id] = 0;
     }
     for (auto& vn : phases_to_go) {
         if (vn.algorithm != nullptr) {
@@ -51,6 +51,12 @@ class BaseStream : public Callable, public StreamStat {
     StreamState state;
     bool initialized;
 
+    // handles into the queue (ready list or active streams) the stream is
+    // currently in, so it can be removed without searching the queue
+    std::list<BaseStream*>::iterator queue_position;
+    std::list<BaseStream*>* waiting_queue;
+    Sys::WaitingIndex::iterator waiting_position;
+
     Tick last_phase_change;
 
     int test;
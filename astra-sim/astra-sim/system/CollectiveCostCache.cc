@@ -0,0 +1,229 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#include "astra-sim/system/CollectiveCostCache.hh"
+
+#include <algorithm>
+#include <tuple>
+
+#include "astra-sim/common/Logging.hh"
+#include "astra-sim/system/ReplayedCollective.hh"
+#include "astra-sim/system/Sys.hh"
+
+using namespace std;
+using namespace AstraSim;
+
+bool CollectiveFingerprint::operator<(
+    const CollectiveFingerprint& other) const {
+    return tie(type, size, dimensions_involved, involved_NPUs, root) <
+           tie(other.type, other.size, other.dimensions_involved,
+               other.involved_NPUs, other.root);
+}
+
+CollectiveCostCache::Entry::Entry() {
+    offsets_repeated = false;
+    valid = false;
+    recording = false;
+    contaminated = false;
+    foreign_traffic_tick = 0;
+    foreign_traffic = false;
+    pending_ranks = 0;
+    participants = 0;
+    first_instance = 0;
+}
+
+CollectiveCostCache::CollectiveCostCache() {
+    hits = 0;
+    misses = 0;
+    in_flight = 0;
+    recordings = 0;
+}
+
+CollectiveCostCache::Ticket* CollectiveCostCache::issue(
+    int rank, const CollectiveFingerprint& fingerprint, int participants) {
+    Entry& entry = entries[fingerprint];
+    entry.participants = participants;
+    uint64_t index = entry.issued[rank]++ - entry.first_instance;
+    if (index == entry.instances.size()) {
+        entry.instances.push_back(
+            {decide(entry), 0, Sys::boostedTick(), {}, {}});
+    }
+    Instance& instance = entry.instances[index];
+    Tick offset = Sys::boostedTick() - instance.first_issue_tick;
+    instance.offsets[rank] = offset;
+    if (instance.decision == Decision::Replay) {
+        auto it = entry.recorded_offsets.find(rank);
+        if (it == entry.recorded_offsets.end() || it->second != offset) {
+            simulate_instance(fingerprint, entry, instance);
+        }
+    }
+    Ticket* ticket = new Ticket;
+    ticket->fingerprint = fingerprint;
+    ticket->rank = rank;
+    ticket->decision = instance.decision;
+    ticket->latency = 0;
+    ticket->instance = entry.first_instance + index;
+    ticket->replay = nullptr;
+    if (ticket->decision == Decision::Replay) {
+        instance.replays.push_back(ticket);
+    }
+    instance.consumers++;
+    while (!entry.instances.empty() &&
+           entry.instances.front().consumers == participants) {
+        retire(entry, entry.instances.front());
+        entry.instances.pop_front();
+        entry.first_instance++;
+    }
+
+    // a replayed collective stands for traffic the network would carry until
+    // its completion event, so it keeps the network busy just the same
+    in_flight++;
+    contaminate_recordings(ticket->decision == Decision::Record ? &entry
+                                                                : nullptr);
+    if (ticket->decision == Decision::Replay) {
+        auto it = entry.latency.find(rank);
+        if (it == entry.latency.end()) {
+            Sys::sys_panic("collective cost cache has no latency for rank " +
+                           to_string(rank));
+        }
+        ticket->latency = it->second;
+        hits++;
+        return ticket;
+    }
+    misses++;
+    return ticket;
+}
+
+CollectiveCostCache::Decision CollectiveCostCache::decide(Entry& entry) {
+    if (in_flight > 0) {
+        return Decision::Simulate;
+    }
+    if (entry.valid) {
+        return Decision::Replay;
+    }
+    if (recordings > 0) {
+        // the ranks of the running recording that did not issue their part
+        // yet would overlap with this one
+        return Decision::Simulate;
+    }
+    entry.recording = true;
+    entry.contaminated = false;
+    entry.foreign_traffic = false;
+    entry.pending_ranks = entry.participants;
+    entry.latency.clear();
+    recordings++;
+    return Decision::Record;
+}
+
+void CollectiveCostCache::retire(Entry& entry, const Instance& instance) {
+    if (instance.decision == Decision::Record) {
+        entry.recorded_offsets = instance.offsets;
+        entry.offsets_repeated = instance.offsets == entry.last_offsets;
+    }
+    entry.last_offsets = instance.offsets;
+}
+
+bool CollectiveCostCache::confirm(Ticket* ticket) {
+    Entry& entry = entries[ticket->fingerprint];
+    if (ticket->instance < entry.first_instance) {
+        // all ranks issued the instance, each with the recorded skew
+        return true;
+    }
+    // a rank that issued before this one finished in the recording did not
+    // issue yet
+    simulate_instance(ticket->fingerprint, entry,
+                      entry.instances[ticket->instance - entry.first_instance]);
+    return false;
+}
+
+void CollectiveCostCache::simulate_instance(
+    const CollectiveFingerprint& fingerprint,
+    Entry& entry,
+    Instance& instance) {
+    LoggerFactory::get_logger("system")->debug(
+        "collective cost cache simulates a collective of {} bytes that was "
+        "issued with a different skew than recorded",
+        fingerprint.size);
+    instance.decision = Decision::Simulate;
+    entry.valid = false;
+    for (Ticket* ticket : instance.replays) {
+        hits--;
+        misses++;
+        ticket->replay->simulate();
+    }
+    instance.replays.clear();
+}
+
+bool CollectiveCostCache::replayable(const Entry& entry) {
+    Tick last_issue = 0;
+    for (const auto& it : entry.recorded_offsets) {
+        last_issue = max(last_issue, it.second);
+    }
+    for (const auto& it : entry.latency) {
+        auto offset = entry.recorded_offsets.find(it.first);
+        if (offset == entry.recorded_offsets.end() ||
+            offset->second + it.second <= last_issue) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void CollectiveCostCache::finish(Ticket* ticket, Tick latency) {
+    if (ticket->decision == Decision::Record) {
+        Entry& entry = entries[ticket->fingerprint];
+        entry.latency[ticket->rank] = latency;
+        // traffic issued in the tick the rank finished cannot have slowed
+        // it down
+        if (entry.foreign_traffic &&
+            Sys::boostedTick() > entry.foreign_traffic_tick) {
+            entry.contaminated = true;
+        }
+    }
+    complete(ticket);
+}
+
+void CollectiveCostCache::abandon(Ticket* ticket) {
+    if (ticket->decision == Decision::Record) {
+        entries[ticket->fingerprint].contaminated = true;
+    }
+    complete(ticket);
+}
+
+void CollectiveCostCache::complete(Ticket* ticket) {
+    in_flight--;
+    if (ticket->decision == Decision::Record) {
+        Entry& entry = entries[ticket->fingerprint];
+        if (--entry.pending_ranks == 0) {
+            entry.recording = false;
+            entry.valid = !entry.contaminated && entry.offsets_repeated &&
+                          replayable(entry);
+            recordings--;
+            if (entry.valid) {
+                LoggerFactory::get_logger("system")->debug(
+                    "collective cost cache recorded a collective of {} bytes",
+                    ticket->fingerprint.size);
+            }
+        }
+    }
+    delete ticket;
+}
+
+void CollectiveCostCache::notify_traffic() {
+    contaminate_recordings(nullptr);
+}
+
+void CollectiveCostCache::contaminate_recordings(Entry* except) {
+    if (recordings == 0) {
+        return;
+    }
+    for (auto& it : entries) {
+        Entry& entry = it.second;
+        if (entry.recording && &entry != except && !entry.foreign_traffic) {
+            entry.foreign_traffic = true;
+            entry.foreign_traffic_tick = Sys::boostedTick();
+        }
+    }
+}
@@ -0,0 +1,155 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#ifndef __COLLECTIVE_COST_CACHE_HH__
+#define __COLLECTIVE_COST_CACHE_HH__
+
+#include <deque>
+#include <map>
+#include <vector>
+
+#include "astra-sim/system/Common.hh"
+
+namespace AstraSim {
+
+class ReplayedCollective;
+
+// Everything that makes two collectives behave the same on an idle network,
+// apart from the skew of the ranks issuing them, which is only known once all
+// ranks issued an instance. The implementations and the chunking come from the
+// system input, which is the same for all ranks of a run.
+class CollectiveFingerprint {
+  public:
+    ComType type;
+    uint64_t size;
+    std::vector<bool> dimensions_involved;
+    // ranks of the communicator group, empty for all ranks
+    std::vector<int> involved_NPUs;
+    // root of a rooted collective, -1 otherwise
+    int root;
+
+    bool operator<(const CollectiveFingerprint& other) const;
+};
+
+/*
+ * CollectiveCostCache memoises the per-rank completion latencies of
+ * collectives that ran on an otherwise idle network, so that later instances
+ * of the same collective can be replayed as a plain delay instead of being
+ * simulated packet by packet.
+ *
+ * Whether an instance is replayed is decided once, by the first rank that
+ * issues it, and every other rank follows that decision; a collective that is
+ * replayed by some ranks and simulated by others would never finish. The
+ * latencies depend on the ticks the ranks issued the instance at relative to
+ * each other, which are not known yet when the decision is taken, so a
+ * recording is only kept if it was issued with the same skew as the instance
+ * before it, i.e. the skew repeats, and if every rank of it finished after the
+ * last rank issued. A rank checks its skew against the recording before it
+ * replays, and a replay checks that all ranks issued before it completes, as
+ * they did in the recording. If either check fails, the instance is simulated
+ * instead and the recording is retried on the next idle instance; the ranks
+ * that already replay it start simulating it from that tick on, later than
+ * they issued it. The network counts as idle when no collective, simulated
+ * or replayed, is in flight on any rank at that point, so a collective
+ * overlapping a replay is simulated and never recorded. A recording is thrown
+ * away if any rank of it finishes after other traffic was issued. The cache
+ * is shared by all Sys objects, so it requires every rank to live in the same
+ * process.
+ */
+class CollectiveCostCache {
+  public:
+    enum class Decision { Simulate = 0, Record, Replay };
+
+    // what one rank does for one instance of a collective
+    class Ticket {
+      public:
+        CollectiveFingerprint fingerprint;
+        int rank;
+        Decision decision;
+        // completion latency of the rank, only valid for Replay
+        Tick latency;
+        // instance of the fingerprint the ticket belongs to
+        uint64_t instance;
+        // set by the rank once it replays the collective
+        ReplayedCollective* replay;
+    };
+
+    CollectiveCostCache();
+    // called by every rank before generating a collective
+    Ticket* issue(int rank,
+                  const CollectiveFingerprint& fingerprint,
+                  int participants);
+    // called by a Replay ticket before it completes; false if the instance is
+    // simulated instead
+    bool confirm(Ticket* ticket);
+    // called once the collective of a ticket finished, replayed or not
+    void finish(Ticket* ticket, Tick latency);
+    // called instead of finish if the collective did not run at all
+    void abandon(Ticket* ticket);
+    // called for traffic that is not part of a collective
+    void notify_traffic();
+
+    uint64_t hits;
+    uint64_t misses;
+
+  private:
+    class Instance {
+      public:
+        Decision decision;
+        int consumers;
+        Tick first_issue_tick;
+        // issue tick of every rank relative to the first one
+        std::map<int, Tick> offsets;
+        // Replay tickets of the ranks that issued the instance so far
+        std::vector<Ticket*> replays;
+    };
+    class Entry {
+      public:
+        Entry();
+        // latencies of the last complete recording, per rank
+        std::map<int, Tick> latency;
+        // issue offsets of the recording and of the last instance all ranks
+        // issued
+        std::map<int, Tick> recorded_offsets;
+        std::map<int, Tick> last_offsets;
+        bool offsets_repeated;
+        bool valid;
+        bool recording;
+        bool contaminated;
+        // tick other traffic was first issued at during the recording
+        Tick foreign_traffic_tick;
+        bool foreign_traffic;
+        int pending_ranks;
+        int participants;
+        // decisions of the instances some ranks have not issued yet;
+        // instances[i] belongs to instance first_instance + i
+        std::deque<Instance> instances;
+        uint64_t first_instance;
+        std::map<int, uint64_t> issued;
+    };
+
+    Decision decide(Entry& entry);
+    // called once all ranks issued an instance
+    void retire(Entry& entry, const Instance& instance);
+    // turns an instance that was not issued with the recorded skew from a
+    // replay into a simulation
+    void simulate_instance(const CollectiveFingerprint& fingerprint,
+                           Entry& entry,
+                           Instance& instance);
+    // whether every rank of the recording finished after the last one issued
+    bool replayable(const Entry& entry);
+    void complete(Ticket* ticket);
+    // notes the traffic in every running recording except the given one
+    void contaminate_recordings(Entry* except);
+
+    std::map<CollectiveFingerprint, Entry> entries;
+    // tickets whose collective did not finish yet
+    int in_flight;
+    int recordings;
+};
+
+}  // namespace AstraSim
+
+#endif /* __COLLECTIVE_COST_CACHE_HH__ */
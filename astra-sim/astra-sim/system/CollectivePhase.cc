@@ -5,7 +5,14 @@ LICENSE file in the root directory of this source tree.
 
 #include "astra-sim/system/CollectivePhase.hh"
 
+#include "astra-sim/system/Sys.hh"
 #include "astra-sim/system/astraccl/Algorithm.hh"
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/BidirectionalCollective.hh"
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/HalvingDoubling.hh"
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/HyperCube.hh"
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/Mesh.hh"
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/Ring.hh"
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/RootedCollective.hh"
 
 using namespace AstraSim;
 
@@ -18,12 +25,50 @@ CollectivePhase::CollectivePhase(Sys* sys, int queue_id, Algorithm* algorithm) {
     this->final_data_size = algorithm->final_data_size;
     this->comm_type = algorithm->comType;
     this->enabled = algorithm->enabled;
+    this->topology = nullptr;
+    this->direction = RingTopology::Direction::Clockwise;
+    this->injection_policy = InjectionPolicy::Normal;
+    this->collective_impl = nullptr;
+    this->root = -1;
+}
+
+CollectivePhase::CollectivePhase(Sys* sys,
+                                 int queue_id,
+                                 ComType comm_type,
+                                 BasicLogicalTopology* topology,
+                                 uint64_t data_size,
+                                 RingTopology::Direction direction,
+                                 InjectionPolicy injection_policy,
+                                 CollectiveImpl* collective_impl) {
+    this->sys = sys;
+    this->queue_id = queue_id;
+    this->algorithm = nullptr;
+    this->enabled = true;
+    this->initial_data_size = data_size;
+    this->comm_type = comm_type;
+    this->topology = topology;
+    this->direction = direction;
+    this->injection_policy = injection_policy;
+    this->collective_impl = collective_impl;
+    this->root = -1;
+    // double binary tree, pipelined tree and in-network reduction only
+    // implement all-reduce
+    if (collective_impl->type == CollectiveImplType::DoubleBinaryTree ||
+        collective_impl->type == CollectiveImplType::PipelinedTree ||
+        collective_impl->type == CollectiveImplType::InNetwork) {
+        this->comm_type = ComType::All_Reduce;
+    }
+    this->final_data_size =
+        get_final_data_size(topology->get_num_of_nodes_in_dimension(0));
 }
 
 CollectivePhase::CollectivePhase() {
     queue_id = -1;
     sys = nullptr;
     algorithm = nullptr;
+    topology = nullptr;
+    collective_impl = nullptr;
+    root = -1;
 }
 
 void CollectivePhase::init(BaseStream* stream) {
@@ -31,3 +76,52 @@ void CollectivePhase::init(BaseStream* stream) {
         algorithm->init(stream);
     }
 }
+
+void CollectivePhase::instantiate() {
+    if (algorithm != nullptr || collective_impl == nullptr) {
+        return;
+    }
+    algorithm = sys->generate_collective_algorithm(
+        comm_type, topology, initial_data_size, direction, injection_policy,
+        collective_impl, root);
+    if (collective_impl->type != CollectiveImplType::ChakraImpl &&
+        algorithm->final_data_size != final_data_size) {
+        Sys::sys_panic("collective phase planned a final data size of " +
+                       std::to_string(final_data_size) +
+                       " but its algorithm produces " +
+                       std::to_string(algorithm->final_data_size));
+    }
+}
+
+// Asks the algorithm class the phase will create for its final data size, so
+// that the following phases can be planned before the algorithm exists.
+uint64_t CollectivePhase::get_final_data_size(int nodes) const {
+    if (comm_type == ComType::Broadcast || comm_type == ComType::Reduce ||
+        comm_type == ComType::Gather) {
+        return RootedCollective::get_final_data_size(comm_type,
+                                                     initial_data_size, nodes);
+    }
+    switch (collective_impl->type) {
+    case CollectiveImplType::Ring:
+    case CollectiveImplType::OneRing:
+    case CollectiveImplType::Direct:
+    case CollectiveImplType::OneDirect:
+        return Ring::get_final_data_size(comm_type, initial_data_size, nodes);
+    case CollectiveImplType::Mesh:
+        return Mesh::get_final_data_size(comm_type, initial_data_size, nodes);
+    case CollectiveImplType::HyperCube:
+        return HyperCube::get_final_data_size(comm_type, initial_data_size,
+                                              nodes);
+    case CollectiveImplType::HalvingDoubling:
+    case CollectiveImplType::OneHalvingDoubling:
+        return HalvingDoubling::get_final_data_size(comm_type,
+                                                    initial_data_size, nodes);
+    case CollectiveImplType::BidirectionalRing:
+    case CollectiveImplType::Swing:
+        return BidirectionalCollective::get_final_data_size(
+            comm_type, initial_data_size, nodes);
+    default:
+        // the tree and in-network all-reduces keep the data size
+        return initial_data_size;
+    }
+}
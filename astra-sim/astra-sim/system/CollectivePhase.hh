@@ -7,6 +7,7 @@ LICENSE file in the root directory of this source tree.
 #define __COLLECTIVE_PHASE_HH__
 
 #include "astra-sim/system/Common.hh"
+#include "astra-sim/system/astraccl/native_collectives/logical_topology/RingTopology.hh"
 
 namespace AstraSim {
 
@@ -17,8 +18,19 @@ class BaseStream;
 class CollectivePhase {
   public:
     CollectivePhase(Sys* sys, int queue_id, Algorithm* algorithm);
+    // Describes the phase without creating its algorithm yet, the algorithm
+    // is created by instantiate() once the stream reaches the phase.
+    CollectivePhase(Sys* sys,
+                    int queue_id,
+                    ComType comm_type,
+                    BasicLogicalTopology* topology,
+                    uint64_t data_size,
+                    RingTopology::Direction direction,
+                    InjectionPolicy injection_policy,
+                    CollectiveImpl* collective_impl);
     CollectivePhase();
     void init(BaseStream* stream);
+    void instantiate();
 
     Sys* sys;
     int queue_id;
@@ -27,6 +39,16 @@ class CollectivePhase {
     uint64_t final_data_size;
     bool enabled;
     ComType comm_type;
+
+    BasicLogicalTopology* topology;
+    RingTopology::Direction direction;
+    InjectionPolicy injection_policy;
+    CollectiveImpl* collective_impl;
+    // root of a broadcast, reduce or gather, -1 otherwise
+    int root;
+
+  private:
+    uint64_t get_final_data_size(int nodes) const;
 };
 
 }  // namespace AstraSim
@@ -46,7 +46,10 @@ enum class ComType {
     All_Gather,
     All_Reduce,
     All_to_All,
-    All_Reduce_All_to_All
+    All_Reduce_All_to_All,
+    Broadcast,
+    Reduce,
+    Gather
 };
 
 enum class CollectiveOptimization { Baseline = 0, LocalBWAware };
@@ -66,6 +69,11 @@ enum class CollectiveImplType {
     ChakraImpl,
     Mesh,
     HyperCube,
+    BinomialTree,
+    PipelinedTree,
+    BidirectionalRing,
+    Swing,
+    InNetwork,
 };
 
 enum class CollectiveBarrier { Blocking = 0, Non_Blocking };
@@ -99,6 +107,8 @@ enum class PacketRouting { Hardware = 0, Software };
 
 enum class BusType { Both = 0, Shared, Mem };
 
+enum class SharedBusMode { PerPacket = 0, Batched };
+
 enum class StreamState {
     Created = 0,
     Transferring,
@@ -172,6 +182,24 @@ class DirectCollectiveImpl : public CollectiveImpl {
     int direct_collective_window;
 };
 
+/*
+ * PipelinedTreeCollectiveImpl contains the number of sub-chunks a pipelined
+ * tree all-reduce splits its data into, which is also defined in the system
+ * layer input.
+ */
+class PipelinedTreeCollectiveImpl : public CollectiveImpl {
+  public:
+    CloneInterface* clone() const {
+        return new PipelinedTreeCollectiveImpl(*this);
+    };
+    PipelinedTreeCollectiveImpl(int sub_chunks)
+        : CollectiveImpl(CollectiveImplType::PipelinedTree) {
+        this->sub_chunks = sub_chunks;
+    }
+
+    int sub_chunks;
+};
+
 /*
  * ChakraCollectiveImpl contains information about a collective implementation
  * represented using the Chakra ET format. It containes the filename of the
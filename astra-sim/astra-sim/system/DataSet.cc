@@ -21,6 +21,8 @@ DataSet::DataSet(int total_streams) {
     this->active = true;
     this->creation_tick = Sys::boostedTick();
     this->notifier = nullptr;
+    this->cost_cache_ticket = nullptr;
+    this->closed_form_sys = nullptr;
 }
 
 void DataSet::set_notifier(Callable* callable, EventType event) {
@@ -35,6 +37,16 @@ void DataSet::notify_stream_finished(StreamStat* data) {
     if (finished_streams == total_streams) {
         finished = true;
         finish_tick = Sys::boostedTick();
+        if (closed_form_sys != nullptr) {
+            closed_form_sys->collective_streams_in_flight--;
+        }
+        // the cache has to see the collective finish before the notifier
+        // issues the next one
+        if (cost_cache_ticket != nullptr) {
+            Sys::collective_cost_cache->finish(cost_cache_ticket,
+                                               finish_tick - creation_tick);
+            cost_cache_ticket = nullptr;
+        }
         if (notifier != nullptr) {
             take_stream_stats_average();
             Callable* c = notifier->first;
@@ -49,6 +61,11 @@ void DataSet::notify_stream_finished(StreamStat* data) {
 }
 
 void DataSet::call(EventType event, CallData* data) {
+    if (event == EventType::CollectiveCommunicationFinished) {
+        // the collective simulated in place of this replay finished
+        notify_stream_finished(nullptr);
+        return;
+    }
     notify_stream_finished(((StreamStat*)data));
 }
 
@@ -8,11 +8,14 @@ LICENSE file in the root directory of this source tree.
 
 #include "astra-sim/system/CallData.hh"
 #include "astra-sim/system/Callable.hh"
+#include "astra-sim/system/CollectiveCostCache.hh"
 #include "astra-sim/system/Common.hh"
 #include "astra-sim/system/StreamStat.hh"
 
 namespace AstraSim {
 
+class Sys;
+
 class DataSet : public Callable, public StreamStat {
   public:
     DataSet(int total_streams);
@@ -30,6 +33,10 @@ class DataSet : public Callable, public StreamStat {
     Tick finish_tick;
     Tick creation_tick;
     std::pair<Callable*, EventType>* notifier;
+    // set if the collective is simulated while the cost cache is enabled
+    CollectiveCostCache::Ticket* cost_cache_ticket;
+    // set if the collective is evaluated in closed form by this Sys
+    Sys* closed_form_sys;
 };
 
 }  // namespace AstraSim
@@ -32,6 +32,12 @@ LogGP::LogGP(std::string name,
     this->NPU_MEM = nullptr;
     request_num = 0;
     this->local_reduction_delay = sys->local_reduction_delay;
+    this->batched_send_free = 0;
+    this->batched_last_trans = 0;
+    this->batched_prev_send = false;
+    this->batched_processing_free = 0;
+    this->batched_receive_start = 0;
+    this->batched_receive_free = 0;
 }
 
 LogGP::~LogGP() {
@@ -98,6 +104,125 @@ void LogGP::request_read(int bytes,
     }
 }
 
+void LogGP::request_read_batched(int bytes,
+                                 bool processed,
+                                 bool send_back,
+                                 Callable* callable,
+                                 Tick completion_delay) {
+    MemMovRequest mr(request_num++, sys, this, bytes, 0, callable, processed,
+                     send_back);
+    Tick current = Sys::boostedTick();
+    Tick finish = plan_read(current, bytes, processed, send_back, mr);
+    SharedBusStat* tmp = new SharedBusStat(
+        BusType::Shared, mr.total_transfer_queue_time, mr.total_transfer_time,
+        mr.total_processing_queue_time, mr.total_processing_time);
+    tmp->update_bus_stats(BusType::Mem, mr);
+    // mr.loggp is the side the request retires on
+    sys->register_event(callable, mr.loggp->trigger_event, tmp,
+                        finish - current + completion_delay);
+}
+
+Tick LogGP::plan_read(Tick ready_time,
+                      int bytes,
+                      bool processed,
+                      bool send_back,
+                      MemMovRequest& mr) {
+    Tick time = ready_time;
+    if (NPU_MEM != nullptr) {
+        time = plan_mem_bus(NPU_MEM->MA_side, time, bytes, false, mr);
+        mr.total_transfer_queue_time += time - ready_time;
+    }
+    time = plan_send(time, bytes, mr);
+    return partner->plan_receive(time, bytes, processed, send_back, mr);
+}
+
+Tick LogGP::plan_send(Tick ready_time, int bytes, MemMovRequest& mr) {
+    Tick start = std::max(ready_time, batched_send_free);
+    if (batched_receive_start <= start && start < batched_receive_free) {
+        start = batched_receive_free;
+    }
+    Tick offset = o;
+    if (batched_prev_send) {
+        if ((o + (start - batched_last_trans)) <= g) {
+            offset = g - (start - batched_last_trans);
+        }
+    }
+    Tick send_finished = start + (Tick)(offset + (G * (bytes - 1)));
+    Tick rec_finished = start + (Tick)(offset + ((bytes - 1) * G) + L + o);
+    batched_send_free = send_finished;
+    batched_last_trans = send_finished;
+    batched_prev_send = true;
+    partner->batched_last_trans = rec_finished;
+    partner->batched_prev_send = false;
+    if (start >= partner->batched_receive_free) {
+        partner->batched_receive_start = start;
+    }
+    partner->batched_receive_free =
+        std::max(partner->batched_receive_free, rec_finished);
+    mr.total_transfer_queue_time += start - ready_time;
+    mr.total_transfer_time += rec_finished - start;
+    return rec_finished;
+}
+
+Tick LogGP::plan_receive(Tick arrival_time,
+                         int bytes,
+                         bool processed,
+                         bool send_back,
+                         MemMovRequest& mr) {
+    Tick time = arrival_time;
+    if (processed) {
+        if (NPU_MEM != nullptr) {
+            Tick ready_time = time;
+            time = plan_mem_bus(NPU_MEM->NPU_side, time, bytes, true, mr);
+            mr.total_processing_queue_time += time - ready_time;
+        }
+        time = plan_processing(time, bytes, mr);
+    }
+    if (send_back) {
+        if (NPU_MEM != nullptr) {
+            Tick ready_time = time;
+            time = plan_mem_bus(NPU_MEM->NPU_side, time, bytes, true, mr);
+            mr.total_transfer_queue_time += time - ready_time;
+        }
+        time = plan_send(time, bytes, mr);
+        return partner->plan_receive(time, bytes, false, false, mr);
+    }
+    if (NPU_MEM != nullptr) {
+        time = plan_mem_bus(NPU_MEM->NPU_side, time, bytes, false, mr);
+    }
+    mr.loggp = this;
+    return time;
+}
+
+Tick LogGP::plan_mem_bus(LogGP* side,
+                         Tick ready_time,
+                         int bytes,
+                         bool send_back,
+                         MemMovRequest& mr) {
+    // the nested bus is planned as a request of its own, and its delays are
+    // folded into the mem bus stats of mr the way MemMovRequest::call does it
+    MemMovRequest nested(side->request_num++, sys, side, bytes, 0, nullptr,
+                         false, send_back);
+    Tick time = side->plan_read(ready_time, bytes, false, send_back, nested);
+    mr.total_mem_bus_transfer_queue_delay += nested.total_transfer_queue_time;
+    mr.total_mem_bus_transfer_delay += nested.total_transfer_time;
+    mr.total_mem_bus_processing_queue_delay +=
+        nested.total_processing_queue_time;
+    mr.total_mem_bus_processing_delay += nested.total_processing_time;
+    mr.mem_request_counter = 1;
+    return time;
+}
+
+Tick LogGP::plan_processing(Tick ready_time, int bytes, MemMovRequest& mr) {
+    Tick start = std::max(ready_time, batched_processing_free);
+    Tick processing_finished =
+        start + ((bytes / 100) * local_reduction_delay) + 50;
+    batched_processing_free = processing_finished;
+    mr.total_processing_queue_time += start - ready_time;
+    mr.total_processing_time += processing_finished - start;
+    return processing_finished;
+}
+
 void LogGP::switch_to_receiver(MemMovRequest mr, Tick offset) {
     mr.start_time = Sys::boostedTick();
     receives.push_back(mr);
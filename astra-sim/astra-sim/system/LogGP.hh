@@ -32,6 +32,36 @@ class LogGP : public Callable {
                       bool send_back,
                       Callable* callable);
     void switch_to_receiver(MemMovRequest mr, Tick offset);
+
+    // Closed-form (batched) shared-bus model. Instead of walking every
+    // request through the send/receive/processing lists event by event,
+    // the completion time of the whole request chain is computed up front
+    // and a single event is emitted when the request retires. It matches
+    // the per-packet engine for FIFO request trains; under contention, bus
+    // time is reserved in issue order and the THRESHOLD-based arbitration
+    // between the two sides of the bus is not modeled.
+    void request_read_batched(int bytes,
+                              bool processed,
+                              bool send_back,
+                              Callable* callable,
+                              Tick completion_delay);
+    Tick plan_read(Tick ready_time,
+                   int bytes,
+                   bool processed,
+                   bool send_back,
+                   MemMovRequest& mr);
+    Tick plan_send(Tick ready_time, int bytes, MemMovRequest& mr);
+    Tick plan_receive(Tick arrival_time,
+                      int bytes,
+                      bool processed,
+                      bool send_back,
+                      MemMovRequest& mr);
+    Tick plan_processing(Tick ready_time, int bytes, MemMovRequest& mr);
+    Tick plan_mem_bus(LogGP* side,
+                      Tick ready_time,
+                      int bytes,
+                      bool send_back,
+                      MemMovRequest& mr);
     void call(EventType event, CallData* data);
     void attach_mem_bus(Sys* sys,
                         Tick L,
@@ -70,6 +100,14 @@ class LogGP : public Callable {
     int subsequent_reads;
     int THRESHOLD;
     int local_reduction_delay;
+
+    // state of the batched model
+    Tick batched_send_free;
+    Tick batched_last_trans;
+    bool batched_prev_send;
+    Tick batched_processing_free;
+    Tick batched_receive_start;
+    Tick batched_receive_free;
 };
 
 }  // namespace AstraSim
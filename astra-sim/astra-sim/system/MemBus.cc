@@ -44,21 +44,37 @@ void MemBus::send_from_NPU_to_MA(MemBus::Transmition transmition,
                                  bool processed,
                                  bool send_back,
                                  Callable* callable) {
+    send_from_NPU_to_MA(transmition, bytes, processed, send_back, callable, 0);
+}
+
+void MemBus::send_from_NPU_to_MA(MemBus::Transmition transmition,
+                                 int bytes,
+                                 bool processed,
+                                 bool send_back,
+                                 Callable* callable,
+                                 Tick completion_delay) {
     if (model_shared_bus && transmition == Transmition::Usual) {
-        NPU_side->request_read(bytes, processed, send_back, callable);
+        if (sys->shared_bus_mode == SharedBusMode::Batched) {
+            NPU_side->request_read_batched(bytes, processed, send_back,
+                                           callable, completion_delay);
+        } else {
+            assert(completion_delay == 0);
+            NPU_side->request_read(bytes, processed, send_back, callable);
+        }
     } else {
         if (transmition == Transmition::Fast) {
             SharedBusStat* ss = new SharedBusStat(BusType::Shared, 0, 10, 0, 0);
             ss->sys_id = sys->id;
             ss->event = EventType::NPU_to_MA;
-            sys->register_event(callable, EventType::NPU_to_MA, ss, 10);
+            sys->register_event(callable, EventType::NPU_to_MA, ss,
+                                10 + completion_delay);
         } else {
             SharedBusStat* ss = new SharedBusStat(BusType::Shared, 0,
                                                   communication_delay, 0, 0);
             ss->sys_id = sys->id;
             ss->event = EventType::NPU_to_MA;
             sys->register_event(callable, EventType::NPU_to_MA, ss,
-                                communication_delay);
+                                communication_delay + completion_delay);
         }
     }
 }
@@ -68,21 +84,42 @@ void MemBus::send_from_MA_to_NPU(MemBus::Transmition transmition,
                                  bool processed,
                                  bool send_back,
                                  Callable* callable) {
+    send_from_MA_to_NPU(transmition, bytes, processed, send_back, callable, 0);
+}
+
+void MemBus::send_from_MA_to_NPU(MemBus::Transmition transmition,
+                                 int bytes,
+                                 bool processed,
+                                 bool send_back,
+                                 Callable* callable,
+                                 Tick completion_delay) {
     if (model_shared_bus && transmition == Transmition::Usual) {
-        MA_side->request_read(bytes, processed, send_back, callable);
+        if (sys->shared_bus_mode == SharedBusMode::Batched) {
+            MA_side->request_read_batched(bytes, processed, send_back,
+                                          callable, completion_delay);
+        } else {
+            assert(completion_delay == 0);
+            MA_side->request_read(bytes, processed, send_back, callable);
+        }
     } else {
         if (transmition == Transmition::Fast) {
             SharedBusStat* ss = new SharedBusStat(BusType::Shared, 0, 10, 0, 0);
             ss->sys_id = sys->id;
             ss->event = EventType::MA_to_NPU;
-            sys->register_event(callable, EventType::MA_to_NPU, ss, 10);
+            sys->register_event(callable, EventType::MA_to_NPU, ss,
+                                10 + completion_delay);
         } else {
             SharedBusStat* ss = new SharedBusStat(BusType::Shared, 0,
                                                   communication_delay, 0, 0);
             ss->sys_id = sys->id;
             ss->event = EventType::MA_to_NPU;
             sys->register_event(callable, EventType::MA_to_NPU, ss,
-                                communication_delay);
+                                communication_delay + completion_delay);
         }
     }
 }
+
+bool MemBus::is_closed_form(MemBus::Transmition transmition) {
+    return !model_shared_bus || transmition == Transmition::Fast ||
+           sys->shared_bus_mode == SharedBusMode::Batched;
+}
@@ -36,11 +36,26 @@ class MemBus {
                              bool processed,
                              bool send_back,
                              Callable* callable);
+    void send_from_NPU_to_MA(Transmition transmition,
+                             int bytes,
+                             bool processed,
+                             bool send_back,
+                             Callable* callable,
+                             Tick completion_delay);
     void send_from_MA_to_NPU(Transmition transmition,
                              int bytes,
                              bool processed,
                              bool send_back,
                              Callable* callable);
+    void send_from_MA_to_NPU(Transmition transmition,
+                             int bytes,
+                             bool processed,
+                             bool send_back,
+                             Callable* callable,
+                             Tick completion_delay);
+    // true if the completion time of a transfer is known when it is issued,
+    // so that extra delays (completion_delay) can be folded into it.
+    bool is_closed_form(Transmition transmition);
 
     LogGP* NPU_side;
     LogGP* MA_side;
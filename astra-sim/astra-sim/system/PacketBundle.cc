@@ -40,25 +40,56 @@ PacketBundle::PacketBundle(Sys* sys,
 }
 
 void PacketBundle::send_to_MA() {
+    if (fold_processing_delay()) {
+        sys->memBus->send_from_NPU_to_MA(transmition, size, true, send_back,
+                                         this, delay);
+        return;
+    }
     sys->memBus->send_from_NPU_to_MA(transmition, size, needs_processing,
                                      send_back, this);
 }
 
 void PacketBundle::send_to_NPU() {
+    if (fold_processing_delay()) {
+        sys->memBus->send_from_MA_to_NPU(transmition, size, true, send_back,
+                                         this, delay);
+        return;
+    }
     sys->memBus->send_from_MA_to_NPU(transmition, size, needs_processing,
                                      send_back, this);
 }
 
+bool PacketBundle::fold_processing_delay() {
+    // The local processing delay only depends on the bundle size, so when the
+    // memory bus delay is also known at issue time, both are covered by a
+    // single event instead of a separate CommProcessingFinished round-trip.
+    if (!needs_processing || !sys->fold_processing_delay ||
+        !sys->memBus->is_closed_form(transmition)) {
+        return false;
+    }
+    needs_processing = false;
+    delay = processing_delay();
+    return true;
+}
+
+Tick PacketBundle::processing_delay() {
+    return get_processing_delay(sys, size);
+}
+
+Tick PacketBundle::get_processing_delay(Sys* sys, uint64_t size) {
+    // delay[ns], size[bytes] local_mem_bw[bytes/s]
+    return static_cast<uint64_t>(static_cast<double>(size) /
+                                 sys->local_mem_bw * 1e9)  // write
+           + static_cast<uint64_t>(static_cast<double>(size) /
+                                   sys->local_mem_bw * 1e9)  // read
+           + static_cast<uint64_t>(static_cast<double>(size) /
+                                   sys->local_mem_bw * 1e9);  // read
+}
+
 void PacketBundle::call(EventType event, CallData* data) {
     if (needs_processing == true) {
         needs_processing = false;
-        // this->delay[ns], size[bytes] local_mem_bw[bytes/s]
-        this->delay = static_cast<uint64_t>(static_cast<double>(size) /
-                                            sys->local_mem_bw * 1e9)  // write
-                      + static_cast<uint64_t>(static_cast<double>(size) /
-                                              sys->local_mem_bw * 1e9)  // read
-                      + static_cast<uint64_t>(static_cast<double>(size) /
-                                              sys->local_mem_bw * 1e9);  // read
+        this->delay = processing_delay();
         sys->try_register_event(this, EventType::CommProcessingFinished, data,
                                 this->delay);
         return;
@@ -32,6 +32,10 @@ class PacketBundle : public Callable {
                  MemBus::Transmition transmition);
     void send_to_MA();
     void send_to_NPU();
+    bool fold_processing_delay();
+    Tick processing_delay();
+    // delay of reducing a received message of size bytes into local data
+    static Tick get_processing_delay(Sys* sys, uint64_t size);
     void call(EventType event, CallData* data);
 
     Sys* sys;
@@ -14,6 +14,7 @@ RecvPacketEventHandlerData::RecvPacketEventHandlerData() {
     this->wlhd = nullptr;
     this->owner = nullptr;
     this->custom_algorithm = nullptr;
+    this->message_size = 0;
 }
 
 RecvPacketEventHandlerData::RecvPacketEventHandlerData(
@@ -27,4 +28,5 @@ RecvPacketEventHandlerData::RecvPacketEventHandlerData(
     this->stream_id = stream_id;
     this->message_end = true;
     ready_time = Sys::boostedTick();
+    this->message_size = 0;
 }
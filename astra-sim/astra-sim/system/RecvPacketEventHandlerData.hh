@@ -31,6 +31,8 @@ class RecvPacketEventHandlerData : public BasicEventHandlerData {
     int stream_id;
     bool message_end;
     Tick ready_time;
+    // size of the message the receive was posted for
+    uint64_t message_size;
 };
 
 }  // namespace AstraSim
@@ -0,0 +1,68 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#include "astra-sim/system/ReplayedCollective.hh"
+
+#include "astra-sim/system/DataSet.hh"
+#include "astra-sim/system/Sys.hh"
+
+using namespace std;
+using namespace AstraSim;
+
+ReplayedCollective::ReplayedCollective(
+    Sys* sys,
+    CollectiveCostCache::Ticket* ticket,
+    uint64_t size,
+    LogicalTopology* topology,
+    vector<CollectiveImpl*> implementation_per_dimension,
+    vector<bool> dimensions_involved,
+    ComType collective_type,
+    int root,
+    int explicit_priority,
+    CommunicatorGroup* communicator_group) {
+    this->sys = sys;
+    this->ticket = ticket;
+    this->dataset = nullptr;
+    this->cancelled = false;
+    this->size = size;
+    this->topology = topology;
+    this->implementation_per_dimension = implementation_per_dimension;
+    this->dimensions_involved = dimensions_involved;
+    this->collective_type = collective_type;
+    this->root = root;
+    this->explicit_priority = explicit_priority;
+    this->communicator_group = communicator_group;
+}
+
+void ReplayedCollective::call(EventType type, CallData* data) {
+    // the ticket belongs to the simulation once cancelled
+    if (!cancelled && Sys::collective_cost_cache->confirm(ticket)) {
+        dataset->notify_stream_finished(nullptr);
+    }
+    delete this;
+}
+
+void ReplayedCollective::simulate() {
+    cancelled = true;
+    dataset->cost_cache_ticket = nullptr;
+    ticket->decision = CollectiveCostCache::Decision::Simulate;
+    ticket->replay = nullptr;
+    sys->cost_cache_hits--;
+    sys->cost_cache_misses++;
+    DataSet* simulated;
+    if (root == -1) {
+        simulated = sys->simulate_collective(
+            size, topology, implementation_per_dimension, dimensions_involved,
+            collective_type, explicit_priority, communicator_group, ticket);
+    } else {
+        simulated = sys->simulate_rooted_collective(
+            size, topology, implementation_per_dimension, dimensions_involved,
+            collective_type, root, explicit_priority, communicator_group,
+            ticket);
+    }
+    // the workload waits on the dataset of the replay
+    simulated->set_notifier(dataset,
+                            EventType::CollectiveCommunicationFinished);
+}
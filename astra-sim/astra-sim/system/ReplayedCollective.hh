@@ -0,0 +1,64 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#ifndef __REPLAYED_COLLECTIVE_HH__
+#define __REPLAYED_COLLECTIVE_HH__
+
+#include <vector>
+
+#include "astra-sim/system/CallData.hh"
+#include "astra-sim/system/Callable.hh"
+#include "astra-sim/system/CollectiveCostCache.hh"
+#include "astra-sim/system/Common.hh"
+
+namespace AstraSim {
+
+class Sys;
+class DataSet;
+class LogicalTopology;
+class CommunicatorGroup;
+
+// A collective a rank replays from the collective cost cache. It is called
+// once the cached latency passed and deletes itself then. It keeps what the
+// rank needs to simulate the collective after all, in case the cache finds
+// that the instance was not issued with the recorded skew.
+class ReplayedCollective : public Callable {
+  public:
+    ReplayedCollective(
+        Sys* sys,
+        CollectiveCostCache::Ticket* ticket,
+        uint64_t size,
+        LogicalTopology* topology,
+        std::vector<CollectiveImpl*> implementation_per_dimension,
+        std::vector<bool> dimensions_involved,
+        ComType collective_type,
+        int root,
+        int explicit_priority,
+        CommunicatorGroup* communicator_group);
+    void call(EventType type, CallData* data);
+    // simulates the collective from now on, and finishes the dataset of the
+    // replay once the simulation finished
+    void simulate();
+
+    Sys* sys;
+    CollectiveCostCache::Ticket* ticket;
+    // returned to the workload in place of the collective
+    DataSet* dataset;
+    // set once the collective is simulated, the completion event is ignored
+    bool cancelled;
+    uint64_t size;
+    LogicalTopology* topology;
+    std::vector<CollectiveImpl*> implementation_per_dimension;
+    std::vector<bool> dimensions_involved;
+    ComType collective_type;
+    // -1 for a collective without root
+    int root;
+    int explicit_priority;
+    CommunicatorGroup* communicator_group;
+};
+
+}  // namespace AstraSim
+
+#endif /* __REPLAYED_COLLECTIVE_HH__ */
@@ -7,6 +7,7 @@ LICENSE file in the root directory of this source tree.
 
 #include <cstdlib>
 #include <iostream>
+#include <numeric>
 
 #include "astra-sim/common/Logging.hh"
 #include "astra-sim/system/BaseStream.hh"
@@ -14,9 +15,11 @@ LICENSE file in the root directory of this source tree.
 #include "astra-sim/system/DataSet.hh"
 #include "astra-sim/system/MemBus.hh"
 #include "astra-sim/system/MemEventHandlerData.hh"
+#include "astra-sim/system/PacketBundle.hh"
 #include "astra-sim/system/QueueLevels.hh"
 #include "astra-sim/system/RendezvousRecvData.hh"
 #include "astra-sim/system/RendezvousSendData.hh"
+#include "astra-sim/system/ReplayedCollective.hh"
 #include "astra-sim/system/SendPacketEventHandlerData.hh"
 #include "astra-sim/system/SimRecvCaller.hh"
 #include "astra-sim/system/SimSendCaller.hh"
@@ -24,23 +27,30 @@ LICENSE file in the root directory of this source tree.
 #include "astra-sim/system/WorkloadLayerHandlerData.hh"
 #include "astra-sim/system/astraccl/custom_collectives/CollectiveParser.hh"
 #include "astra-sim/system/astraccl/native_collectives/collective_algorithm/AllToAll.hh"
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/BidirectionalRing.hh"
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/BinomialTree.hh"
 #include "astra-sim/system/astraccl/native_collectives/collective_algorithm/DoubleBinaryTreeAllReduce.hh"
 #include "astra-sim/system/astraccl/native_collectives/collective_algorithm/HalvingDoubling.hh"
 #include "astra-sim/system/astraccl/native_collectives/collective_algorithm/HyperCube.hh"
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/InNetworkAllReduce.hh"
 #include "astra-sim/system/astraccl/native_collectives/collective_algorithm/Mesh.hh"
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/PipelinedTreeAllReduce.hh"
 #include "astra-sim/system/astraccl/native_collectives/collective_algorithm/Ring.hh"
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/RootedRing.hh"
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/Swing.hh"
 #include "astra-sim/system/astraccl/native_collectives/logical_topology/BasicLogicalTopology.hh"
 #include "astra-sim/system/astraccl/native_collectives/logical_topology/GeneralComplexTopology.hh"
 #include "astra-sim/system/scheduling/OfflineGreedy.hh"
-#include <json/json.hpp>
 
 using namespace std;
 using namespace Chakra;
-using json = nlohmann::json;
 
 namespace AstraSim {
 uint8_t* Sys::dummy_data = new uint8_t[2];
 vector<Sys*> Sys::all_sys;
+CollectiveCostCache* Sys::collective_cost_cache = nullptr;
+map<pair<vector<int>, int>, Sys::ClosedFormDecision>
+    Sys::closed_form_decisions;
 
 // SchedulerUnit --------------------------------------------------------------
 Sys::SchedulerUnit::SchedulerUnit(Sys* sys,
@@ -61,8 +71,7 @@ Sys::SchedulerUnit::SchedulerUnit(Sys* sys,
     for (auto q : queues) {
         for (int i = 0; i < q; i++) {
             this->running_streams[base] = 0;
-            list<BaseStream*>::iterator it;
-            this->stream_pointer[base] = it;
+            this->stream_pointer[base] = sys->active_Streams[base].end();
             this->queue_id_to_dimension[base] = dimension;
             base++;
         }
@@ -77,10 +86,11 @@ void Sys::SchedulerUnit::notify_stream_added(int vnet) {
         ++total_active_chunks_per_dimension[queue_id_to_dimension[vnet]] == 1) {
         usage[queue_id_to_dimension[vnet]].increase_usage();
     }
-    stream_pointer[vnet] = sys->active_Streams[vnet].begin();
-    advance(stream_pointer[vnet], running_streams[vnet]);
+    // stream_pointer always points to the first stream of the queue that is
+    // not running yet
     while (stream_pointer[vnet] != sys->active_Streams[vnet].end() &&
            running_streams[vnet] < queue_threshold) {
+        sys->remove_from_waiting_index(*stream_pointer[vnet]);
         (*stream_pointer[vnet])->init();
         running_streams[vnet]++;
         advance(stream_pointer[vnet], 1);
@@ -94,7 +104,11 @@ void Sys::SchedulerUnit::notify_stream_added_into_ready_list() {
         if (max > max_running_streams - this->sys->total_running_streams) {
             max = max_running_streams - this->sys->total_running_streams;
         }
-        sys->schedule(max);
+        if (sys->synchronized_scheduling) {
+            sys->ask_for_schedule(max);
+        } else {
+            sys->schedule(max);
+        }
     }
     return;
 }
@@ -116,12 +130,17 @@ void Sys::SchedulerUnit::notify_stream_removed(int vnet, Tick running_time) {
         if (max > max_running_streams - this->sys->total_running_streams) {
             max = max_running_streams - this->sys->total_running_streams;
         }
-        sys->schedule(max);
+        if (sys->synchronized_scheduling) {
+            sys->ask_for_schedule(max);
+        } else {
+            sys->schedule(max);
+        }
     }
-    stream_pointer[vnet] = sys->active_Streams[vnet].begin();
-    advance(stream_pointer[vnet], running_streams[vnet]);
+    // stream_pointer always points to the first stream of the queue that is
+    // not running yet
     while (stream_pointer[vnet] != sys->active_Streams[vnet].end() &&
            running_streams[vnet] < queue_threshold) {
+        sys->remove_from_waiting_index(*stream_pointer[vnet]);
         (*stream_pointer[vnet])->init();
         running_streams[vnet]++;
         advance(stream_pointer[vnet], 1);
@@ -173,9 +192,13 @@ Sys::Sys(int id,
     this->inp_g = 0;
     this->inp_G = 0;
     this->model_shared_bus = 0;
+    this->shared_bus_mode = SharedBusMode::PerPacket;
     this->injection_scale = injection_scale;
     this->communication_delay = 0;
     this->local_reduction_delay = 0;
+    this->fold_processing_delay = false;
+    this->closed_form_collectives = false;
+    this->collective_streams_in_flight = 0;
 
     this->comm_NI = comm_NI;
     this->comm_scale = comm_scale;
@@ -194,12 +217,17 @@ Sys::Sys(int id,
 
     this->last_scheduled_collective = 0;
 
+    this->synchronized_scheduling = false;
     this->first_phase_streams = 0;
+    this->ready_barrier_stream = -1;
     this->total_running_streams = 0;
 
     this->communication_delay = 10;
     this->local_reduction_delay = 1;
 
+    this->cost_cache_hits = 0;
+    this->cost_cache_misses = 0;
+
     if (initialize_sys(system_configuration) == false) {
         sys_panic("Unable to initialize the system layer because the file can "
                   "not be openned");
@@ -290,6 +318,15 @@ Sys::~Sys() {
     for (auto ci : all_to_all_implementation_per_dimension) {
         delete ci;
     }
+    for (auto ci : broadcast_implementation_per_dimension) {
+        delete ci;
+    }
+    for (auto ci : reduce_implementation_per_dimension) {
+        delete ci;
+    }
+    for (auto ci : gather_implementation_per_dimension) {
+        delete ci;
+    }
 
     if (scheduler_unit != nullptr) {
         delete scheduler_unit;
@@ -320,222 +357,84 @@ Sys::~Sys() {
     }
 
     if (shouldExit) {
+        if (collective_cost_cache != nullptr) {
+            LoggerFactory::get_logger("system")->info(
+                "collective cost cache: {} hits, {} misses",
+                collective_cost_cache->hits, collective_cost_cache->misses);
+            delete collective_cost_cache;
+            collective_cost_cache = nullptr;
+        }
+        SysConfig::clear();
         exit_sim_loop("Exiting");
     }
 }
 
 bool Sys::initialize_sys(string name) {
-    ifstream inFile;
-    inFile.open(name);
-    if (!inFile) {
-        if (id == 0) {
-            LoggerFactory::get_logger("system")->critical(
-                "Unable to open file: {}", name);
-        }
-        exit(1);
-    }
-
-    json j;
-    inFile >> j;
-    if (j.contains("scheduling-policy")) {
-        string inp_scheduling_policy = j["scheduling-policy"];
-        if (inp_scheduling_policy == "LIFO") {
-            this->scheduling_policy = SchedulingPolicy::LIFO;
-        } else if (inp_scheduling_policy == "FIFO") {
-            this->scheduling_policy = SchedulingPolicy::FIFO;
-        } else if (inp_scheduling_policy == "EXPLICIT") {
-            this->scheduling_policy = SchedulingPolicy::EXPLICIT;
-        } else {
-            sys_panic("unknown value for scheduling policy in sys input file");
-        }
-    }
-    if (j.contains("all-reduce-implementation")) {
-        vector<string> collective_impl_str_vec = j["all-reduce-implementation"];
-        for (auto collective_impl_str : collective_impl_str_vec) {
-            CollectiveImpl* ci =
-                generate_collective_impl_from_input(collective_impl_str);
-            all_reduce_implementation_per_dimension.push_back(ci);
-        }
-    }
-    if (j.contains("reduce-scatter-implementation")) {
-        vector<string> collective_impl_str_vec =
-            j["reduce-scatter-implementation"];
-        for (auto collective_impl_str : collective_impl_str_vec) {
-            CollectiveImpl* ci =
-                generate_collective_impl_from_input(collective_impl_str);
-            reduce_scatter_implementation_per_dimension.push_back(ci);
-        }
-    }
-    if (j.contains("all-gather-implementation")) {
-        vector<string> collective_impl_str_vec = j["all-gather-implementation"];
-        for (auto collective_impl_str : collective_impl_str_vec) {
-            CollectiveImpl* ci =
-                generate_collective_impl_from_input(collective_impl_str);
-            all_gather_implementation_per_dimension.push_back(ci);
-        }
-    }
-    if (j.contains("all-to-all-implementation")) {
-        vector<string> collective_impl_str_vec = j["all-to-all-implementation"];
-        for (auto collective_impl_str : collective_impl_str_vec) {
-            CollectiveImpl* ci =
-                generate_collective_impl_from_input(collective_impl_str);
-            all_to_all_implementation_per_dimension.push_back(ci);
-        }
-    }
-    if (j.contains("all-to-all-implementation-custom")) {
-        vector<string> chakra_filepath_str_vec =
-            j["all-to-all-implementation-custom"];
-        all_to_all_implementation_per_dimension.clear();
-        if (chakra_filepath_str_vec.size() != 1) {
-            throw logic_error(
-                "There should be 1 Chakra ET only. In multi-dim collectives, "
-                "that 1 ET file covers all dimensions");
-        }
-        CollectiveImpl* ci =
-            generate_custom_collective_impl(chakra_filepath_str_vec[0]);
-        all_to_all_implementation_per_dimension.push_back(ci);
-    }
-    if (j.contains("all-gather-implementation-custom")) {
-        vector<string> chakra_filepath_str_vec =
-            j["all-gather-implementation-custom"];
-        all_gather_implementation_per_dimension.clear();
-        if (chakra_filepath_str_vec.size() != 1) {
-            throw logic_error(
-                "There should be 1 Chakra ET only. In multi-dim collectives, "
-                "that 1 ET file covers all dimensions");
-        }
-        CollectiveImpl* ci =
-            generate_custom_collective_impl(chakra_filepath_str_vec[0]);
-        all_gather_implementation_per_dimension.push_back(ci);
-    }
-    if (j.contains("all-reduce-implementation-custom")) {
-        vector<string> chakra_filepath_str_vec =
-            j["all-reduce-implementation-custom"];
-        all_reduce_implementation_per_dimension.clear();
-        if (chakra_filepath_str_vec.size() != 1) {
-            throw logic_error(
-                "There should be 1 Chakra ET only. In multi-dim collectives, "
-                "that 1 ET file covers all dimensions");
-        }
-        CollectiveImpl* ci =
-            generate_custom_collective_impl(chakra_filepath_str_vec[0]);
-        all_reduce_implementation_per_dimension.push_back(ci);
-    }
-    if (j.contains("collective-optimization")) {
-        string inp_collective_optimization = j["collective-optimization"];
-        if (inp_collective_optimization == "baseline") {
-            collectiveOptimization = CollectiveOptimization::Baseline;
-        } else if (inp_collective_optimization == "localBWAware") {
-            collectiveOptimization = CollectiveOptimization::LocalBWAware;
-        } else {
-            sys_panic(
-                "unknown value for collective optimization in sys input file");
-        }
-    }
-    if (j.contains("local-reduction-delay")) {
-        local_reduction_delay = j["local-reduction-delay"];
-    }
-    if (j.contains("active-chunks-per-dimension")) {
-        active_chunks_per_dimension = j["active-chunks-per-dimension"];
-    }
-    if (j.contains("L")) {
-        inp_L = j["L"];
-    }
-    if (j.contains("o")) {
-        inp_o = j["o"];
-    }
-    if (j.contains("g")) {
-        inp_g = j["g"];
-    }
-    if (j.contains("G")) {
-        inp_G = j["G"];
-    }
-    if (j.contains("endpoint-delay")) {
-        communication_delay = j["endpoint-delay"];
+    config = SysConfig::get(name);
+    if (config == nullptr) {
+        return false;
+    }
+
+    scheduling_policy = config->scheduling_policy;
+    intra_dimension_scheduling = config->intra_dimension_scheduling;
+    inter_dimension_scheduling = config->inter_dimension_scheduling;
+    collectiveOptimization = config->collective_optimization;
+    all_reduce_implementation_per_dimension =
+        clone_implementations(config->all_reduce_implementation_per_dimension);
+    reduce_scatter_implementation_per_dimension = clone_implementations(
+        config->reduce_scatter_implementation_per_dimension);
+    all_gather_implementation_per_dimension =
+        clone_implementations(config->all_gather_implementation_per_dimension);
+    all_to_all_implementation_per_dimension =
+        clone_implementations(config->all_to_all_implementation_per_dimension);
+    broadcast_implementation_per_dimension =
+        clone_implementations(config->broadcast_implementation_per_dimension);
+    reduce_implementation_per_dimension =
+        clone_implementations(config->reduce_implementation_per_dimension);
+    gather_implementation_per_dimension =
+        clone_implementations(config->gather_implementation_per_dimension);
+    local_reduction_delay = config->local_reduction_delay;
+    fold_processing_delay = config->fold_processing_delay;
+    closed_form_collectives = config->closed_form_collectives;
+    synchronized_scheduling = config->synchronized_scheduling;
+    active_chunks_per_dimension = config->active_chunks_per_dimension;
+    inp_L = config->inp_L;
+    inp_o = config->inp_o;
+    inp_g = config->inp_g;
+    inp_G = config->inp_G;
+    if (config->endpoint_delay_specified) {
+        communication_delay = config->endpoint_delay;
         communication_delay = communication_delay * injection_scale;
     }
-    if (j.contains("model-shared-bus")) {
-        int inp_model_shared_bus = j["model-shared-bus"];
-        if (inp_model_shared_bus == 1) {
-            model_shared_bus = true;
-        } else {
-            model_shared_bus = false;
-        }
-    } else {
-        model_shared_bus = false;
+    model_shared_bus = config->model_shared_bus;
+    shared_bus_mode = config->shared_bus_mode;
+    preferred_dataset_splits = config->preferred_dataset_splits;
+    peak_perf = config->peak_perf;
+    local_mem_bw = config->local_mem_bw;
+    if (config->roofline_enabled) {
+        roofline_enabled = true;
+        roofline = new Roofline(local_mem_bw, peak_perf);
     }
-    if (j.contains("preferred-dataset-splits")) {
-        preferred_dataset_splits = j["preferred-dataset-splits"];
+    trace_enabled = config->trace_enabled;
+    replay_only = config->replay_only;
+    if (config->collective_cost_cache && collective_cost_cache == nullptr) {
+        collective_cost_cache = new CollectiveCostCache();
     }
-    if (j.contains("peak-perf")) {
-        peak_perf = j["peak-perf"];
-        peak_perf = peak_perf * 1000000000000;  // TFLOPS
-    }
-    if (j.contains("local-mem-bw")) {
-        local_mem_bw = j["local-mem-bw"];
-        local_mem_bw = local_mem_bw * 1000000000;  // GB/sec
-    }
-    if (j.contains("roofline-enabled")) {
-        if (j["roofline-enabled"] != 0) {
-            roofline_enabled = true;
-            roofline = new Roofline(local_mem_bw, peak_perf);
-        }
-    }
-    this->trace_enabled = false;
-    if (j.contains("trace-enabled")) {
-        if (j["trace-enabled"] != 0) {
-            this->trace_enabled = true;
-        } else {
-            this->trace_enabled = false;
-        }
-    }
-    this->replay_only = false;
-    if (j.contains("replay-only")) {
-        if (j["replay-only"] != 0) {
-            this->replay_only = true;
-        } else {
-            this->replay_only = false;
-        }
-    }
-
-    inFile.close();
     return true;
 }
 
-CollectiveImpl* Sys::generate_collective_impl_from_input(
-    string collective_impl_str) {
-    if (collective_impl_str == "ring") {
-        return new CollectiveImpl(CollectiveImplType::Ring);
-    } else if (collective_impl_str == "mesh") {
-        return new CollectiveImpl(CollectiveImplType::Mesh);
-    } else if (collective_impl_str == "hypercube") {
-        return new CollectiveImpl(CollectiveImplType::HyperCube);
-    } else if (collective_impl_str == "oneRing") {
-        return new CollectiveImpl(CollectiveImplType::OneRing);
-    } else if (collective_impl_str == "doubleBinaryTree") {
-        return new CollectiveImpl(CollectiveImplType::DoubleBinaryTree);
-    } else if (collective_impl_str.rfind("direct", 0) == 0) {
-        int window = -1;
-        if (collective_impl_str != "direct") {
-            window = stoi(collective_impl_str.substr(6, 5));
-        }
-        return new DirectCollectiveImpl(CollectiveImplType::Direct, window);
-    } else if (collective_impl_str.rfind("oneDirect", 0) == 0) {
-        int window = -1;
-        if (collective_impl_str != "oneDirect") {
-            window = stoi(collective_impl_str.substr(9, 5));
+vector<CollectiveImpl*> Sys::clone_implementations(
+    const vector<CollectiveImpl*>& implementation_per_dimension) {
+    vector<CollectiveImpl*> result;
+    for (auto ci : implementation_per_dimension) {
+        if (ci->type == CollectiveImplType::ChakraImpl) {
+            result.push_back(generate_custom_collective_impl(
+                ((ChakraCollectiveImpl*)ci)->filename));
+        } else {
+            result.push_back((CollectiveImpl*)ci->clone());
         }
-        return new DirectCollectiveImpl(CollectiveImplType::OneDirect, window);
-    } else if (collective_impl_str == "halvingDoubling") {
-        return new CollectiveImpl(CollectiveImplType::HalvingDoubling);
-    } else if (collective_impl_str == "oneHalvingDoubling") {
-        return new CollectiveImpl(CollectiveImplType::OneHalvingDoubling);
-    } else {
-        sys_panic("Cannot interpret collective implementations. Please check "
-                  "the collective implementations in the sys"
-                  "input file");
-        return new CollectiveImpl(CollectiveImplType::Ring);
     }
+    return result;
 }
 
 CollectiveImpl* Sys::generate_custom_collective_impl(
@@ -680,6 +579,20 @@ LogicalTopology* Sys::get_logical_topology(ComType comm_type) {
         return logical_topologies["ReduceScatter"];
     } else if (comm_type == ComType::All_Gather) {
         return logical_topologies["AllGather"];
+    } else if (comm_type == ComType::Broadcast ||
+               comm_type == ComType::Reduce || comm_type == ComType::Gather) {
+        // built on the first use, as few workloads issue rooted collectives
+        string name = "Broadcast";
+        if (comm_type == ComType::Reduce) {
+            name = "Reduce";
+        } else if (comm_type == ComType::Gather) {
+            name = "Gather";
+        }
+        if (logical_topologies.find(name) == logical_topologies.end()) {
+            logical_topologies[name] = new GeneralComplexTopology(
+                id, physical_dims, get_collective_implementation(comm_type));
+        }
+        return logical_topologies[name];
     } else {
         sys_panic("no known logical topology!");
         return nullptr;
@@ -695,6 +608,12 @@ vector<CollectiveImpl*> Sys::get_collective_implementation(ComType comm_type) {
         return reduce_scatter_implementation_per_dimension;
     } else if (comm_type == ComType::All_Gather) {
         return all_gather_implementation_per_dimension;
+    } else if (comm_type == ComType::Broadcast) {
+        return broadcast_implementation_per_dimension;
+    } else if (comm_type == ComType::Reduce) {
+        return reduce_implementation_per_dimension;
+    } else if (comm_type == ComType::Gather) {
+        return gather_implementation_per_dimension;
     } else {
         sys_panic("no known collective implementation!");
         vector<CollectiveImpl*> tmp;
@@ -778,6 +697,66 @@ DataSet* Sys::generate_reduce_scatter(uint64_t size,
     }
 }
 
+DataSet* Sys::generate_broadcast(uint64_t size,
+                                 vector<bool> involved_dimensions,
+                                 CommunicatorGroup* communicator_group,
+                                 int explicit_priority,
+                                 int root) {
+    if (communicator_group == nullptr) {
+        return generate_rooted_collective(
+            size, get_logical_topology(ComType::Broadcast),
+            broadcast_implementation_per_dimension, involved_dimensions,
+            ComType::Broadcast, root, explicit_priority, communicator_group);
+    } else {
+        CollectivePlan* plan =
+            communicator_group->get_collective_plan(ComType::Broadcast);
+        return generate_rooted_collective(
+            size, plan->topology, plan->implementation_per_dimension,
+            plan->dimensions_involved, ComType::Broadcast, root,
+            explicit_priority, communicator_group);
+    }
+}
+
+DataSet* Sys::generate_reduce(uint64_t size,
+                              vector<bool> involved_dimensions,
+                              CommunicatorGroup* communicator_group,
+                              int explicit_priority,
+                              int root) {
+    if (communicator_group == nullptr) {
+        return generate_rooted_collective(
+            size, get_logical_topology(ComType::Reduce),
+            reduce_implementation_per_dimension, involved_dimensions,
+            ComType::Reduce, root, explicit_priority, communicator_group);
+    } else {
+        CollectivePlan* plan =
+            communicator_group->get_collective_plan(ComType::Reduce);
+        return generate_rooted_collective(
+            size, plan->topology, plan->implementation_per_dimension,
+            plan->dimensions_involved, ComType::Reduce, root, explicit_priority,
+            communicator_group);
+    }
+}
+
+DataSet* Sys::generate_gather(uint64_t size,
+                              vector<bool> involved_dimensions,
+                              CommunicatorGroup* communicator_group,
+                              int explicit_priority,
+                              int root) {
+    if (communicator_group == nullptr) {
+        return generate_rooted_collective(
+            size, get_logical_topology(ComType::Gather),
+            gather_implementation_per_dimension, involved_dimensions,
+            ComType::Gather, root, explicit_priority, communicator_group);
+    } else {
+        CollectivePlan* plan =
+            communicator_group->get_collective_plan(ComType::Gather);
+        return generate_rooted_collective(
+            size, plan->topology, plan->implementation_per_dimension,
+            plan->dimensions_involved, ComType::Gather, root, explicit_priority,
+            communicator_group);
+    }
+}
+
 DataSet* Sys::generate_collective(
     uint64_t size,
     LogicalTopology* topology,
@@ -786,11 +765,39 @@ DataSet* Sys::generate_collective(
     ComType collective_type,
     int explicit_priority,
     CommunicatorGroup* communicator_group) {
+    CollectiveCostCache::Ticket* ticket = nullptr;
+    if (collective_cost_cache != nullptr) {
+        ticket = issue_to_cost_cache(size, dimensions_involved,
+                                     collective_type, -1, communicator_group);
+        if (ticket->decision == CollectiveCostCache::Decision::Replay) {
+            return replay_collective(new ReplayedCollective(
+                this, ticket, size, topology, implementation_per_dimension,
+                dimensions_involved, collective_type, -1, explicit_priority,
+                communicator_group));
+        }
+    }
+    return simulate_collective(size, topology, implementation_per_dimension,
+                               dimensions_involved, collective_type,
+                               explicit_priority, communicator_group, ticket);
+}
+
+DataSet* Sys::simulate_collective(
+    uint64_t size,
+    LogicalTopology* topology,
+    vector<CollectiveImpl*> implementation_per_dimension,
+    vector<bool> dimensions_involved,
+    ComType collective_type,
+    int explicit_priority,
+    CommunicatorGroup* communicator_group,
+    CollectiveCostCache::Ticket* ticket) {
     uint64_t chunk_size = determine_chunk_size(size, collective_type);
     uint64_t recommended_chunk_size = chunk_size;
     int streams = ceil(((double)size) / chunk_size);
     uint64_t remain_size;
     DataSet* dataset = new DataSet(streams);
+    // the chunks are only turned into streams once it is known that the
+    // collective can not be evaluated in closed form
+    list<list<CollectivePhase>> closed_form_chunks;
     int pri = get_priority(explicit_priority);
     int count = 0;
     if (id == 0 && (inter_dimension_scheduling ==
@@ -1021,14 +1028,12 @@ DataSet* Sys::generate_collective(
             }
         }
         if (vect.size() > 0) {
-            int stream_id = num_streams++;
-            if (communicator_group != nullptr) {
-                stream_id = communicator_group->num_streams++;
+            if (closed_form_collectives) {
+                closed_form_chunks.push_back(vect);
+            } else {
+                insert_collective_stream(dataset, vect, pri,
+                                         communicator_group);
             }
-            StreamBaseline* newStream =
-                new StreamBaseline(this, dataset, stream_id, vect, pri);
-            newStream->current_queue_id = -1;
-            insert_into_ready_list(newStream);
         } else {
             dataset->active = false;
             break;
@@ -1037,9 +1042,323 @@ DataSet* Sys::generate_collective(
     if (dataset->active) {
         dataset->total_streams = count;
     }
+    if (!closed_form_chunks.empty()) {
+        Tick duration = 0;
+        pair<vector<int>, int> key;
+        bool supported = dataset->active &&
+                         get_closed_form_duration(closed_form_chunks, duration);
+        if (decide_closed_form(communicator_group, supported, key)) {
+            dataset->total_streams = 1;
+            dataset->closed_form_sys = this;
+            collective_streams_in_flight++;
+            join_closed_form(key, dataset, duration);
+        } else {
+            join_closed_form(key, nullptr, 0);
+            for (auto& phases : closed_form_chunks) {
+                insert_collective_stream(dataset, phases, pri,
+                                         communicator_group);
+            }
+        }
+    }
+    track_collective(dataset, ticket);
+    return dataset;
+}
+
+DataSet* Sys::generate_rooted_collective(
+    uint64_t size,
+    LogicalTopology* topology,
+    vector<CollectiveImpl*> implementation_per_dimension,
+    vector<bool> dimensions_involved,
+    ComType collective_type,
+    int root,
+    int explicit_priority,
+    CommunicatorGroup* communicator_group) {
+    CollectiveCostCache::Ticket* ticket = nullptr;
+    if (collective_cost_cache != nullptr) {
+        ticket = issue_to_cost_cache(size, dimensions_involved,
+                                     collective_type, root, communicator_group);
+        if (ticket->decision == CollectiveCostCache::Decision::Replay) {
+            return replay_collective(new ReplayedCollective(
+                this, ticket, size, topology, implementation_per_dimension,
+                dimensions_involved, collective_type, root, explicit_priority,
+                communicator_group));
+        }
+    }
+    return simulate_rooted_collective(
+        size, topology, implementation_per_dimension, dimensions_involved,
+        collective_type, root, explicit_priority, communicator_group, ticket);
+}
+
+DataSet* Sys::simulate_rooted_collective(
+    uint64_t size,
+    LogicalTopology* topology,
+    vector<CollectiveImpl*> implementation_per_dimension,
+    vector<bool> dimensions_involved,
+    ComType collective_type,
+    int root,
+    int explicit_priority,
+    CommunicatorGroup* communicator_group,
+    CollectiveCostCache::Ticket* ticket) {
+    uint64_t chunk_size = determine_chunk_size(size, collective_type);
+    int streams = ceil(((double)size) / chunk_size);
+    DataSet* dataset = new DataSet(streams);
+    int pri = get_priority(explicit_priority);
+    int count = 0;
+
+    // The collective visits the involved dimensions one after the other, the
+    // reduce and gather in ascending order towards the root and the broadcast
+    // in descending order away from it. A node only takes part in the phase of
+    // a dimension if it shares the root's coordinates in all dimensions that
+    // come before it in ascending order, which are the nodes that hold data
+    // for that phase.
+    vector<int> dims;
+    for (int dim = 0; dim < topology->get_num_of_dimensions(); dim++) {
+        if (topology->get_num_of_nodes_in_dimension(dim) > 1 &&
+            dimensions_involved[dim]) {
+            dims.push_back(dim);
+        }
+    }
+    uint64_t active_dims = dims.empty() ? 0 : 1;
+    while (active_dims < dims.size()) {
+        RingTopology* ring =
+            (RingTopology*)topology->get_basic_topology_at_dimension(
+                dims[active_dims - 1], collective_type);
+        if (ring->get_coordinate(id) != ring->get_coordinate(root)) {
+            break;
+        }
+        active_dims++;
+    }
+    dims.resize(active_dims);
+    if (collective_type == ComType::Broadcast) {
+        reverse(dims.begin(), dims.end());
+    }
+
+    while (size > 0) {
+        count++;
+        if (chunk_size > size) {
+            size = 0;
+        } else {
+            size -= chunk_size;
+        }
+        uint64_t remain_size = chunk_size;
+        list<CollectivePhase> vect;
+        for (int dim : dims) {
+            pair<int, RingTopology::Direction> queue =
+                vLevels->get_next_queue_at_level(dim);
+            CollectivePhase phase = generate_collective_phase(
+                collective_type,
+                topology->get_basic_topology_at_dimension(dim,
+                                                          collective_type),
+                remain_size, queue.first, queue.second,
+                InjectionPolicy::Normal, implementation_per_dimension[dim]);
+            phase.root = root;
+            vect.push_back(phase);
+            remain_size = phase.final_data_size;
+        }
+        if (vect.size() > 0) {
+            insert_collective_stream(dataset, vect, pri, communicator_group);
+        } else {
+            dataset->active = false;
+            break;
+        }
+    }
+    if (dataset->active) {
+        dataset->total_streams = count;
+    }
+    track_collective(dataset, ticket);
+    return dataset;
+}
+
+void Sys::insert_collective_stream(DataSet* dataset,
+                                   list<CollectivePhase>& phases,
+                                   int pri,
+                                   CommunicatorGroup* communicator_group) {
+    int stream_id = num_streams++;
+    if (communicator_group != nullptr) {
+        stream_id = communicator_group->num_streams++;
+    }
+    StreamBaseline* newStream =
+        new StreamBaseline(this, dataset, stream_id, phases, pri);
+    newStream->current_queue_id = -1;
+    collective_streams_in_flight++;
+    insert_into_ready_list(newStream);
+}
+
+bool Sys::get_closed_form_duration(list<list<CollectivePhase>>& chunks,
+                                   Tick& duration) {
+    // Without congestion, the chunks only interact through the scheduler:
+    // each dimension runs up to active_chunks_per_dimension chunks at a time,
+    // so chunk i starts once chunk i - active_chunks_per_dimension has left
+    // its slowest phase, and the collective ends with the last chunk.
+    vector<Tick> start;
+    vector<Tick> bottleneck;
+    duration = 0;
+    for (auto& phases : chunks) {
+        Tick total = 0;
+        Tick slowest = 0;
+        bool supported = true;
+        for (auto& phase : phases) {
+            phase.instantiate();
+            Tick phase_duration = 0;
+            if (phase.algorithm == nullptr ||
+                !phase.algorithm->get_closed_form_duration(this,
+                                                           phase_duration)) {
+                supported = false;
+            }
+            // the phases are handed to streams if the collective falls back to
+            // simulation, which instantiate their algorithms again
+            delete phase.algorithm;
+            phase.algorithm = nullptr;
+            if (!supported) {
+                return false;
+            }
+            total += phase_duration;
+            slowest = max(slowest, phase_duration);
+        }
+        int chunk = start.size();
+        Tick chunk_start = 0;
+        if (chunk >= active_chunks_per_dimension) {
+            int previous = chunk - active_chunks_per_dimension;
+            chunk_start = start[previous] + bottleneck[previous];
+        }
+        start.push_back(chunk_start);
+        bottleneck.push_back(slowest);
+        duration = max(duration, chunk_start + total);
+    }
+    return true;
+}
+
+bool Sys::decide_closed_form(CommunicatorGroup* communicator_group,
+                             bool supported,
+                             pair<vector<int>, int>& key) {
+    // The closed form skips the ready list and the scheduler, so it only
+    // matches the simulation if no other collective of this Sys is in flight.
+    // All participants follow the first one: a participant that simulates
+    // would wait for messages the others never send. A collective issued
+    // while a closed form one is in flight is simulated without seeing it.
+    vector<int> involved_NPUs;
+    int participants = all_sys.size();
+    if (communicator_group != nullptr) {
+        involved_NPUs = communicator_group->involved_NPUs;
+        participants = involved_NPUs.size();
+    }
+    key = make_pair(involved_NPUs, closed_form_issued[involved_NPUs]++);
+    auto it = closed_form_decisions.find(key);
+    if (it == closed_form_decisions.end()) {
+        ClosedFormDecision decision;
+        decision.closed_form = supported && collective_streams_in_flight == 0;
+        decision.pending = participants;
+        it = closed_form_decisions.emplace(key, decision).first;
+    } else if (it->second.closed_form && !supported) {
+        sys_panic("NPU " + to_string(id) +
+                  " can't evaluate a collective in closed form that the "
+                  "other participants already evaluated in closed form");
+    }
+    return it->second.closed_form;
+}
+
+void Sys::join_closed_form(const pair<vector<int>, int>& key,
+                           DataSet* dataset,
+                           Tick duration) {
+    // Participants that issued early wait for the late ones in the simulated
+    // collective as well, so every part finishes its duration after the last
+    // participant issued the collective.
+    auto it = closed_form_decisions.find(key);
+    ClosedFormDecision& decision = it->second;
+    if (dataset != nullptr) {
+        decision.waiting.push_back(make_tuple(this, dataset, duration));
+    }
+    if (--decision.pending > 0) {
+        return;
+    }
+    for (auto& part : decision.waiting) {
+        get<0>(part)->register_event(get<1>(part), EventType::General, nullptr,
+                                     get<2>(part));
+    }
+    closed_form_decisions.erase(it);
+}
+
+bool Sys::get_closed_form_step_time(int dst,
+                                    uint64_t size,
+                                    bool reduce,
+                                    MemBus::Transmition transmition,
+                                    Tick& time) {
+    double network_delay = comm_NI->sim_closed_form_send_delay(dst, size);
+    Tick bus_delay = 0;
+    if (network_delay < 0 ||
+        !get_closed_form_bus_delay(transmition, bus_delay)) {
+        return false;
+    }
+    time = static_cast<Tick>(network_delay) + bus_delay;
+    if (reduce) {
+        time += PacketBundle::get_processing_delay(this, size);
+    }
+    return true;
+}
+
+bool Sys::get_closed_form_bus_delay(MemBus::Transmition transmition,
+                                    Tick& delay) {
+    // mirrors the fixed delays of MemBus when the shared bus is not modelled
+    if (transmition == MemBus::Transmition::Fast) {
+        delay = 10;
+        return true;
+    }
+    if (model_shared_bus) {
+        return false;
+    }
+    delay = communication_delay;
+    return true;
+}
+
+CollectiveCostCache::Ticket* Sys::issue_to_cost_cache(
+    uint64_t size,
+    const vector<bool>& dimensions_involved,
+    ComType collective_type,
+    int root,
+    CommunicatorGroup* communicator_group) {
+    CollectiveFingerprint fingerprint;
+    fingerprint.type = collective_type;
+    fingerprint.size = size;
+    fingerprint.dimensions_involved = dimensions_involved;
+    fingerprint.root = root;
+    int participants = all_sys.size();
+    if (communicator_group != nullptr) {
+        fingerprint.involved_NPUs = communicator_group->involved_NPUs;
+        participants = communicator_group->involved_NPUs.size();
+    }
+    CollectiveCostCache::Ticket* ticket =
+        collective_cost_cache->issue(id, fingerprint, participants);
+    if (ticket->decision == CollectiveCostCache::Decision::Replay) {
+        cost_cache_hits++;
+    } else {
+        cost_cache_misses++;
+    }
+    return ticket;
+}
+
+DataSet* Sys::replay_collective(ReplayedCollective* replay) {
+    DataSet* dataset = new DataSet(1);
+    // the replay counts as in flight until the dataset finishes
+    dataset->cost_cache_ticket = replay->ticket;
+    replay->dataset = dataset;
+    replay->ticket->replay = replay;
+    register_event(replay, EventType::General, nullptr,
+                   replay->ticket->latency);
     return dataset;
 }
 
+void Sys::track_collective(DataSet* dataset,
+                           CollectiveCostCache::Ticket* ticket) {
+    if (ticket == nullptr) {
+        return;
+    }
+    if (dataset->active) {
+        dataset->cost_cache_ticket = ticket;
+    } else {
+        collective_cost_cache->abandon(ticket);
+    }
+}
+
 CollectivePhase Sys::generate_collective_phase(
     ComType collective_type,
     BasicLogicalTopology* topology,
@@ -1048,54 +1367,72 @@ CollectivePhase Sys::generate_collective_phase(
     RingTopology::Direction direction,
     InjectionPolicy injection_policy,
     CollectiveImpl* collective_impl) {
-    if (collective_impl->type == CollectiveImplType::Ring ||
+    CollectivePhase vn(this, queue_id, collective_type, topology, data_size,
+                       direction, injection_policy, collective_impl);
+    return vn;
+}
+
+Algorithm* Sys::generate_collective_algorithm(
+    ComType collective_type,
+    BasicLogicalTopology* topology,
+    uint64_t data_size,
+    RingTopology::Direction direction,
+    InjectionPolicy injection_policy,
+    CollectiveImpl* collective_impl,
+    int root) {
+    if (collective_type == ComType::Broadcast ||
+        collective_type == ComType::Reduce ||
+        collective_type == ComType::Gather) {
+        if (collective_impl->type == CollectiveImplType::BinomialTree) {
+            return new BinomialTree(collective_type, id,
+                                    (RingTopology*)topology, data_size, root);
+        }
+        return new RootedRing(collective_type, id, (RingTopology*)topology,
+                              data_size, direction, root);
+    } else if (collective_impl->type == CollectiveImplType::Ring ||
         collective_impl->type == CollectiveImplType::OneRing) {
-        CollectivePhase vn(this, queue_id,
-                           new Ring(collective_type, id,
-                                    (RingTopology*)topology, data_size,
-                                    direction, injection_policy));
-        return vn;
+        return new Ring(collective_type, id, (RingTopology*)topology,
+                        data_size, direction, injection_policy);
+    } else if (collective_impl->type == CollectiveImplType::BidirectionalRing) {
+        return new BidirectionalRing(collective_type, id,
+                                     (RingTopology*)topology, data_size);
+    } else if (collective_impl->type == CollectiveImplType::Swing) {
+        return new Swing(collective_type, id, (RingTopology*)topology,
+                         data_size);
     } else if (collective_impl->type == CollectiveImplType::Mesh) {
-        CollectivePhase vn(
-            this, queue_id,
-            new Mesh(collective_type, id, (MeshTopology*)topology, data_size,
-                     static_cast<MeshTopology::Direction>(direction),
-                     injection_policy));
-        return vn;
+        return new Mesh(collective_type, id, (MeshTopology*)topology,
+                        data_size,
+                        static_cast<MeshTopology::Direction>(direction),
+                        injection_policy);
     } else if (collective_impl->type == CollectiveImplType::HyperCube) {
-        CollectivePhase vn(
-            this, queue_id,
-            new HyperCube(collective_type, id, (HyperCubeTopology*)topology,
-                          data_size,
-                          static_cast<HyperCubeTopology::Direction>(direction),
-                          injection_policy));
-        return vn;
+        return new HyperCube(
+            collective_type, id, (HyperCubeTopology*)topology, data_size,
+            static_cast<HyperCubeTopology::Direction>(direction),
+            injection_policy);
     } else if (collective_impl->type == CollectiveImplType::Direct ||
                collective_impl->type == CollectiveImplType::OneDirect) {
-        CollectivePhase vn(this, queue_id,
-                           new AllToAll(collective_type,
-                                        ((DirectCollectiveImpl*)collective_impl)
-                                            ->direct_collective_window,
-                                        id, (RingTopology*)topology, data_size,
-                                        direction, InjectionPolicy::Normal));
-        return vn;
+        return new AllToAll(
+            collective_type,
+            ((DirectCollectiveImpl*)collective_impl)->direct_collective_window,
+            id, (RingTopology*)topology, data_size, direction,
+            InjectionPolicy::Normal);
     } else if (collective_impl->type == CollectiveImplType::DoubleBinaryTree) {
-        CollectivePhase vn(this, queue_id,
-                           new DoubleBinaryTreeAllReduce(
-                               id, (BinaryTree*)topology, data_size));
-        return vn;
+        return new DoubleBinaryTreeAllReduce(id, (BinaryTree*)topology,
+                                             data_size);
+    } else if (collective_impl->type == CollectiveImplType::InNetwork) {
+        return new InNetworkAllReduce(id, (RingTopology*)topology, data_size);
+    } else if (collective_impl->type == CollectiveImplType::PipelinedTree) {
+        return new PipelinedTreeAllReduce(
+            id, (RingTopology*)topology, data_size,
+            ((PipelinedTreeCollectiveImpl*)collective_impl)->sub_chunks);
     } else if (collective_impl->type == CollectiveImplType::HalvingDoubling ||
                collective_impl->type ==
                    CollectiveImplType::OneHalvingDoubling) {
-        CollectivePhase vn(this, queue_id,
-                           new HalvingDoubling(collective_type, id,
-                                               (RingTopology*)topology,
-                                               data_size));
-        return vn;
+        return new HalvingDoubling(collective_type, id,
+                                   (RingTopology*)topology, data_size);
     } else if (collective_impl->type == CollectiveImplType::ChakraImpl) {
         string filename = ((ChakraCollectiveImpl*)collective_impl)->filename;
-        CollectivePhase vn(this, queue_id, new CustomAlgorithm(filename, id));
-        return vn;
+        return new CustomAlgorithm(filename, id);
     } else {
         LoggerFactory::get_logger("system")->critical(
             "Error: No known collective implementation for collective phase");
@@ -1250,12 +1587,32 @@ void Sys::insert_into_ready_list(BaseStream* stream) {
     scheduler_unit->notify_stream_added_into_ready_list();
 }
 
-void Sys::insert_stream(list<BaseStream*>* queue, BaseStream* baseStream) {
+list<BaseStream*>::iterator Sys::insert_stream(list<BaseStream*>* queue,
+                                               BaseStream* baseStream) {
     list<BaseStream*>::iterator it = queue->begin();
-    if (intra_dimension_scheduling == IntraDimensionScheduling::FIFO ||
-        baseStream->current_queue_id < 0 ||
-        baseStream->current_com_type == ComType::All_to_All ||
-        baseStream->current_com_type == ComType::All_Reduce) {
+    if (queue == &ready_list ||
+        intra_dimension_scheduling == IntraDimensionScheduling::FIFO) {
+        // Every stream of this queue is inserted by priority, so the streams
+        // that are not initialized yet keep the order of the waiting index
+        // and the insertion point is found there instead of walking the
+        // queue.
+        WaitingIndex& index = waiting_streams[queue];
+        WaitingIndex::iterator successor =
+            index.upper_bound(baseStream->priority);
+        if (successor != index.end()) {
+            it = successor->second;
+        } else {
+            it = queue->end();
+        }
+        baseStream->queue_position = queue->insert(it, baseStream);
+        baseStream->waiting_position =
+            index.insert(successor, make_pair(baseStream->priority,
+                                              baseStream->queue_position));
+        baseStream->waiting_queue = queue;
+        return baseStream->queue_position;
+    } else if (baseStream->current_queue_id < 0 ||
+               baseStream->current_com_type == ComType::All_to_All ||
+               baseStream->current_com_type == ComType::All_Reduce) {
         while (it != queue->end()) {
             if ((*it)->initialized == true) {
                 advance(it, 1);
@@ -1328,29 +1685,61 @@ void Sys::insert_stream(list<BaseStream*>* queue, BaseStream* baseStream) {
             }
         }
     }
-    queue->insert(it, baseStream);
+    baseStream->queue_position = queue->insert(it, baseStream);
+    return baseStream->queue_position;
+}
+
+void Sys::remove_from_waiting_index(BaseStream* baseStream) {
+    if (baseStream->waiting_queue == nullptr) {
+        return;
+    }
+    waiting_streams[baseStream->waiting_queue].erase(
+        baseStream->waiting_position);
+    baseStream->waiting_queue = nullptr;
 }
 
 void Sys::ask_for_schedule(int max) {
-    if (ready_list.size() == 0 ||
-        ready_list.front()->synchronizer[ready_list.front()->stream_id] <
-            all_sys.size()) {
+    if (ready_list.size() == 0) {
         return;
     }
     int top = ready_list.front()->stream_id;
+    // Every rank arrives once at the barrier of the stream at the head of its
+    // ready list; ready_counter keeps the number of ranks that arrived.
+    if (ready_barrier_stream != top) {
+        if (ready_barrier_stream != -1 &&
+            --BaseStream::ready_counter[ready_barrier_stream] == 0) {
+            BaseStream::ready_counter.erase(ready_barrier_stream);
+        }
+        ready_barrier_stream = top;
+        BaseStream::ready_counter[top]++;
+    }
+    if (BaseStream::ready_counter[top] < static_cast<int>(all_sys.size())) {
+        return;
+    }
     uint64_t min = ready_list.size();
     if (min > max) {
         min = static_cast<uint64_t>(max);
     }
+    bool all_ready = true;
     for (auto& sys : all_sys) {
         if (sys->ready_list.size() == 0 ||
             sys->ready_list.front()->stream_id != top) {
-            return;
-        }
-        if (sys->ready_list.size() < min) {
+            // the rank has moved on since it arrived, it arrives again once
+            // it asks for its new head
+            sys->ready_barrier_stream = -1;
+            BaseStream::ready_counter[top]--;
+            all_ready = false;
+        } else if (sys->ready_list.size() < min) {
             min = sys->ready_list.size();
         }
     }
+    if (!all_ready) {
+        return;
+    }
+    BaseStream::ready_counter.erase(top);
+    for (auto& sys : all_sys) {
+        sys->ready_barrier_stream = -1;
+    }
     for (auto& sys : all_sys) {
         sys->schedule(min);
     }
@@ -1365,6 +1754,7 @@ void Sys::schedule(int num) {
         int total_waiting_streams = ready_list.size();
         int total_phases = ready_list.front()->phases_to_go.size();
 
+        remove_from_waiting_index(ready_list.front());
         proceed_to_next_vnet_baseline((StreamBaseline*)ready_list.front());
 
         if (ready_list.front()->current_queue_id == -1) {
@@ -1400,18 +1790,18 @@ void Sys::proceed_to_next_vnet_baseline(StreamBaseline* stream) {
     }
     if (stream->phases_to_go.size() == 0) {
         stream->take_bus_stats_average();
+        collective_streams_in_flight--;
         stream->dataset->notify_stream_finished((StreamStat*)stream);
     }
     if (stream->current_queue_id >= 0 && stream->my_current_phase.enabled) {
-        list<BaseStream*>& target =
-            active_Streams.at(stream->my_current_phase.queue_id);
-        for (list<BaseStream*>::iterator it = target.begin();
-             it != target.end(); ++it) {
-            if (((StreamBaseline*)(*it))->stream_id == stream->stream_id) {
-                target.erase(it);
-                break;
-            }
+        int queue_id = stream->my_current_phase.queue_id;
+        list<BaseStream*>& target = active_Streams.at(queue_id);
+        if (scheduler_unit->stream_pointer[queue_id] ==
+            stream->queue_position) {
+            scheduler_unit->stream_pointer[queue_id]++;
         }
+        remove_from_waiting_index(stream);
+        target.erase(stream->queue_position);
     }
     if (stream->phases_to_go.size() == 0) {
         total_running_streams--;
@@ -1434,6 +1824,10 @@ void Sys::proceed_to_next_vnet_baseline(StreamBaseline* stream) {
     CollectivePhase vi = stream->phases_to_go.front();
     stream->my_current_phase = vi;
     stream->phases_to_go.pop_front();
+    if (stream->my_current_phase.algorithm == nullptr) {
+        stream->my_current_phase.instantiate();
+        stream->my_current_phase.init(stream);
+    }
     stream->test = 0;
     stream->test2 = 0;
     stream->initialized = false;
@@ -1444,7 +1838,12 @@ void Sys::proceed_to_next_vnet_baseline(StreamBaseline* stream) {
     stream->net_message_counter = 0;
 
     if (stream->my_current_phase.enabled) {
-        insert_stream(&active_Streams[stream->current_queue_id], stream);
+        int queue_id = stream->current_queue_id;
+        list<BaseStream*>::iterator it =
+            insert_stream(&active_Streams[queue_id], stream);
+        if (next(it) == scheduler_unit->stream_pointer[queue_id]) {
+            scheduler_unit->stream_pointer[queue_id] = it;
+        }
     }
 
     stream->state = StreamState::Ready;
@@ -1467,6 +1866,9 @@ int Sys::front_end_sim_send(Tick delay,
                             void (*msg_handler)(void* fun_arg),
                             void* fun_arg) {
     if (send_type == Sys::FrontEndSendRecvType::NATIVE) {
+        if (collective_cost_cache != nullptr) {
+            collective_cost_cache->notify_traffic();
+        }
         tag = tag % (Sys::FrontEndSendRecvType::COLLECTIVE -
                      Sys::FrontEndSendRecvType::NATIVE) +
               Sys::FrontEndSendRecvType::NATIVE;
@@ -1516,6 +1918,17 @@ int Sys::front_end_sim_recv(Tick delay,
     }
 }
 
+int Sys::front_end_sim_switch_reduce(uint64_t count,
+                                     const std::vector<int>& ranks,
+                                     int tag,
+                                     void (*msg_handler)(void* fun_arg),
+                                     void* fun_arg) {
+    tag = tag % (Sys::FrontEndSendRecvType::RENDEZVOUS -
+                 Sys::FrontEndSendRecvType::COLLECTIVE) +
+          Sys::FrontEndSendRecvType::COLLECTIVE;
+    return comm_NI->sim_switch_reduce(count, ranks, tag, msg_handler, fun_arg);
+}
+
 int Sys::rendezvous_sim_send(Tick delay,
                              void* buffer,
                              uint64_t count,
@@ -11,10 +11,12 @@ LICENSE file in the root directory of this source tree.
 #include "astra-sim/common/AstraNetworkAPI.hh"
 #include "astra-sim/system/AstraRemoteMemoryAPI.hh"
 #include "astra-sim/system/Callable.hh"
+#include "astra-sim/system/CollectiveCostCache.hh"
 #include "astra-sim/system/CollectivePhase.hh"
 #include "astra-sim/system/CommunicatorGroup.hh"
 #include "astra-sim/system/MemBus.hh"
 #include "astra-sim/system/Roofline.hh"
+#include "astra-sim/system/SysConfig.hh"
 #include "astra-sim/system/UsageTracker.hh"
 #include "astra-sim/system/astraccl/native_collectives/logical_topology/RingTopology.hh"
 #include "astra-sim/workload/Workload.hh"
@@ -29,9 +31,17 @@ class Workload;
 class LogicalTopology;
 class BasicLogicalTopology;
 class OfflineGreedy;
+class ReplayedCollective;
 
 class Sys : public Callable {
   public:
+    // Streams of a queue that are not initialized yet, ordered by priority
+    // the same way they are ordered in the queue itself.
+    typedef std::multimap<int,
+                          std::list<BaseStream*>::iterator,
+                          std::greater<int>>
+        WaitingIndex;
+
     // SchedulerUnit
     // ------------------------------------------------------------
     class SchedulerUnit {
@@ -79,8 +89,8 @@ class Sys : public Callable {
     // Intialization
     // ------------------------------------------------------------
     bool initialize_sys(std::string name);
-    CollectiveImpl* generate_collective_impl_from_input(
-        std::string collective_impl_str);
+    std::vector<CollectiveImpl*> clone_implementations(
+        const std::vector<CollectiveImpl*>& implementation_per_dimension);
     CollectiveImpl* generate_custom_collective_impl(
         std::string collective_impl_str);
     //---------------------------------------------------------------------------
@@ -136,6 +146,21 @@ class Sys : public Callable {
                                      std::vector<bool> involved_dimensions,
                                      CommunicatorGroup* communicator_group,
                                      int explicit_priority);
+    DataSet* generate_broadcast(uint64_t size,
+                                std::vector<bool> involved_dimensions,
+                                CommunicatorGroup* communicator_group,
+                                int explicit_priority,
+                                int root);
+    DataSet* generate_reduce(uint64_t size,
+                             std::vector<bool> involved_dimensions,
+                             CommunicatorGroup* communicator_group,
+                             int explicit_priority,
+                             int root);
+    DataSet* generate_gather(uint64_t size,
+                             std::vector<bool> involved_dimensions,
+                             CommunicatorGroup* communicator_group,
+                             int explicit_priority,
+                             int root);
     DataSet* generate_collective(
         uint64_t size,
         LogicalTopology* topology,
@@ -144,6 +169,35 @@ class Sys : public Callable {
         ComType collective_type,
         int explicit_priority,
         CommunicatorGroup* communicator_group);
+    DataSet* generate_rooted_collective(
+        uint64_t size,
+        LogicalTopology* topology,
+        std::vector<CollectiveImpl*> implementation_per_dimension,
+        std::vector<bool> dimensions_involved,
+        ComType collective_type,
+        int root,
+        int explicit_priority,
+        CommunicatorGroup* communicator_group);
+    // generate the streams of a collective the cost cache did not replay
+    DataSet* simulate_collective(
+        uint64_t size,
+        LogicalTopology* topology,
+        std::vector<CollectiveImpl*> implementation_per_dimension,
+        std::vector<bool> dimensions_involved,
+        ComType collective_type,
+        int explicit_priority,
+        CommunicatorGroup* communicator_group,
+        CollectiveCostCache::Ticket* ticket);
+    DataSet* simulate_rooted_collective(
+        uint64_t size,
+        LogicalTopology* topology,
+        std::vector<CollectiveImpl*> implementation_per_dimension,
+        std::vector<bool> dimensions_involved,
+        ComType collective_type,
+        int root,
+        int explicit_priority,
+        CommunicatorGroup* communicator_group,
+        CollectiveCostCache::Ticket* ticket);
     CollectivePhase generate_collective_phase(ComType collective_type,
                                               BasicLogicalTopology* topology,
                                               uint64_t data_size,
@@ -151,6 +205,57 @@ class Sys : public Callable {
                                               RingTopology::Direction direction,
                                               InjectionPolicy injection_policy,
                                               CollectiveImpl* collective_impl);
+    Algorithm* generate_collective_algorithm(ComType collective_type,
+                                             BasicLogicalTopology* topology,
+                                             uint64_t data_size,
+                                             RingTopology::Direction direction,
+                                             InjectionPolicy injection_policy,
+                                             CollectiveImpl* collective_impl,
+                                             int root);
+    // asks the collective cost cache whether to simulate the collective
+    CollectiveCostCache::Ticket* issue_to_cost_cache(
+        uint64_t size,
+        const std::vector<bool>& dimensions_involved,
+        ComType collective_type,
+        int root,
+        CommunicatorGroup* communicator_group);
+    // finishes the collective of a Replay ticket after the cached latency
+    DataSet* replay_collective(ReplayedCollective* replay);
+    // hands a simulated collective over to the cache to be tracked
+    void track_collective(DataSet* dataset,
+                          CollectiveCostCache::Ticket* ticket);
+    // duration of a collective given the phases of each of its chunks, false
+    // if any phase has to be simulated
+    bool get_closed_form_duration(
+        std::list<std::list<CollectivePhase>>& chunks,
+        Tick& duration);
+    // whether a collective may be evaluated in closed form, decided by the
+    // first participant that issues it and followed by all others; supported
+    // tells if this participant has a closed form duration, and a later
+    // participant without one panics as it can't simulate alone; key is set
+    // to the collective the decision belongs to
+    bool decide_closed_form(CommunicatorGroup* communicator_group,
+                            bool supported,
+                            std::pair<std::vector<int>, int>& key);
+    // called by every participant after decide_closed_form, with the dataset
+    // and duration of its part if it is evaluated in closed form and nullptr
+    // otherwise; the parts finish once the last participant issued
+    void join_closed_form(const std::pair<std::vector<int>, int>& key,
+                          DataSet* dataset,
+                          Tick duration);
+    // time of one algorithm step that sends a message of size bytes to dst
+    // and moves the received message to the NPU, reducing it if needed
+    bool get_closed_form_step_time(int dst,
+                                   uint64_t size,
+                                   bool reduce,
+                                   MemBus::Transmition transmition,
+                                   Tick& time);
+    bool get_closed_form_bus_delay(MemBus::Transmition transmition,
+                                   Tick& delay);
+    void insert_collective_stream(DataSet* dataset,
+                                  std::list<CollectivePhase>& phases,
+                                  int pri,
+                                  CommunicatorGroup* communicator_group);
     int break_dimension(int model_parallel_npu_group);
     //---------------------------------------------------------------------------
 
@@ -159,7 +264,9 @@ class Sys : public Callable {
     uint64_t determine_chunk_size(uint64_t& size, ComType type);
     int get_priority(int explicit_priority);
     void insert_into_ready_list(BaseStream* stream);
-    void insert_stream(std::list<BaseStream*>* queue, BaseStream* baseStream);
+    std::list<BaseStream*>::iterator insert_stream(
+        std::list<BaseStream*>* queue, BaseStream* baseStream);
+    void remove_from_waiting_index(BaseStream* baseStream);
     void ask_for_schedule(int max);
     void schedule(int num);
     void proceed_to_next_vnet_baseline(StreamBaseline* stream);
@@ -201,6 +308,13 @@ class Sys : public Callable {
                            FrontEndSendRecvType recv_type,
                            void (*msg_handler)(void* fun_arg),
                            void* fun_arg);
+    // reduces the data of ranks in the switch they share, see
+    // AstraNetworkAPI::sim_switch_reduce
+    int front_end_sim_switch_reduce(uint64_t count,
+                                    const std::vector<int>& ranks,
+                                    int tag,
+                                    void (*msg_handler)(void* fun_arg),
+                                    void* fun_arg);
 
     int rendezvous_sim_send(Tick delay,
                             void* buffer,
@@ -248,6 +362,9 @@ class Sys : public Callable {
     int id;
     bool initialized;
 
+    // system layer input, shared with every Sys using the same input file
+    std::shared_ptr<const SysConfig> config;
+
     // workload
     Workload* workload;
 
@@ -267,9 +384,31 @@ class Sys : public Callable {
     float inp_g;
     float inp_G;
     bool model_shared_bus;
+    SharedBusMode shared_bus_mode;
     double injection_scale;
     int communication_delay;
     int local_reduction_delay;
+    bool fold_processing_delay;
+    // evaluates whole collectives in closed form if the network backend
+    // computes message delays without congestion
+    bool closed_form_collectives;
+    // collective streams of this Sys that did not finish yet, a collective
+    // evaluated in closed form counts as one stream
+    int collective_streams_in_flight;
+    // collectives issued with closed form enabled, per group of involved
+    // NPUs (empty for all NPUs)
+    std::map<std::vector<int>, int> closed_form_issued;
+    // closed form decision of a collective, with the participants that did not
+    // issue it yet and the closed form parts waiting for them
+    class ClosedFormDecision {
+      public:
+        bool closed_form;
+        int pending;
+        std::vector<std::tuple<Sys*, DataSet*, Tick>> waiting;
+    };
+    // closed form decision of each collective per group of involved NPUs
+    static std::map<std::pair<std::vector<int>, int>, ClosedFormDecision>
+        closed_form_decisions;
 
     // network
     AstraNetworkAPI* comm_NI;
@@ -294,9 +433,15 @@ class Sys : public Callable {
     // for supporting LIFO
     std::list<BaseStream*> ready_list;
     SchedulingPolicy scheduling_policy;
+    // schedules the ready list of every rank in lockstep, through
+    // ask_for_schedule
+    bool synchronized_scheduling;
     int first_phase_streams;
+    // stream id whose ready-list barrier this rank has arrived at, -1 if none
+    int ready_barrier_stream;
     int total_running_streams;
     std::map<int, std::list<BaseStream*>> active_Streams;
+    std::map<std::list<BaseStream*>*, WaitingIndex> waiting_streams;
     std::map<int, std::list<int>> stream_priorities;
 
     std::map<Tick, std::list<std::tuple<Callable*, EventType, CallData*>>>
@@ -316,6 +461,9 @@ class Sys : public Callable {
     std::vector<CollectiveImpl*> reduce_scatter_implementation_per_dimension;
     std::vector<CollectiveImpl*> all_gather_implementation_per_dimension;
     std::vector<CollectiveImpl*> all_to_all_implementation_per_dimension;
+    std::vector<CollectiveImpl*> broadcast_implementation_per_dimension;
+    std::vector<CollectiveImpl*> reduce_implementation_per_dimension;
+    std::vector<CollectiveImpl*> gather_implementation_per_dimension;
     CollectiveOptimization collectiveOptimization;
     Tick last_scheduled_collective;
     bool break_dimension_done;
@@ -326,6 +474,13 @@ class Sys : public Callable {
 
     // skip simulation for all nodes and use current duration
     bool replay_only;
+
+    // replays collectives that already ran on an idle network, shared by
+    // all Sys objects and nullptr unless enabled in the system input
+    static CollectiveCostCache* collective_cost_cache;
+    // collectives of this Sys replayed from and missed in the cache
+    uint64_t cost_cache_hits;
+    uint64_t cost_cache_misses;
 };
 
 }  // namespace AstraSim
@@ -0,0 +1,419 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#include "astra-sim/system/SysConfig.hh"
+
+#include <fstream>
+#include <stdexcept>
+
+#include "astra-sim/common/Logging.hh"
+#include "astra-sim/system/Sys.hh"
+#include <json/json.hpp>
+
+using namespace std;
+using json = nlohmann::json;
+
+namespace AstraSim {
+
+map<string, shared_ptr<const SysConfig>> SysConfig::configs;
+
+shared_ptr<const SysConfig> SysConfig::get(string name) {
+    auto it = configs.find(name);
+    if (it != configs.end()) {
+        return it->second;
+    }
+    ifstream inFile;
+    inFile.open(name);
+    if (!inFile) {
+        LoggerFactory::get_logger("system")->critical(
+            "Unable to open file: {}", name);
+        return nullptr;
+    }
+    shared_ptr<const SysConfig> config(new SysConfig(inFile));
+    inFile.close();
+    configs[name] = config;
+    return config;
+}
+
+void SysConfig::clear() {
+    configs.clear();
+}
+
+SysConfig::SysConfig(ifstream& inFile) {
+    this->scheduling_policy = SchedulingPolicy::LIFO;
+    this->intra_dimension_scheduling = IntraDimensionScheduling::FIFO;
+    this->inter_dimension_scheduling = InterDimensionScheduling::Ascending;
+    this->collective_optimization = CollectiveOptimization::Baseline;
+    this->local_reduction_delay = 1;
+    this->fold_processing_delay = false;
+    this->active_chunks_per_dimension = 1;
+    this->inp_L = 0;
+    this->inp_o = 0;
+    this->inp_g = 0;
+    this->inp_G = 0;
+    this->endpoint_delay_specified = false;
+    this->endpoint_delay = 10;
+    this->model_shared_bus = false;
+    this->shared_bus_mode = SharedBusMode::PerPacket;
+    this->preferred_dataset_splits = 0;
+    this->peak_perf = 0;
+    this->local_mem_bw = 0;
+    this->roofline_enabled = false;
+    this->trace_enabled = false;
+    this->replay_only = false;
+    this->collective_cost_cache = false;
+    this->closed_form_collectives = false;
+    this->synchronized_scheduling = false;
+
+    json j;
+    inFile >> j;
+    if (j.contains("scheduling-policy")) {
+        string inp_scheduling_policy = j["scheduling-policy"];
+        if (inp_scheduling_policy == "LIFO") {
+            this->scheduling_policy = SchedulingPolicy::LIFO;
+        } else if (inp_scheduling_policy == "FIFO") {
+            this->scheduling_policy = SchedulingPolicy::FIFO;
+        } else if (inp_scheduling_policy == "EXPLICIT") {
+            this->scheduling_policy = SchedulingPolicy::EXPLICIT;
+        } else {
+            Sys::sys_panic(
+                "unknown value for scheduling policy in sys input file");
+        }
+    }
+    if (j.contains("intra-dimension-scheduling")) {
+        string inp_intra_dimension_scheduling = j["intra-dimension-scheduling"];
+        if (inp_intra_dimension_scheduling == "FIFO") {
+            intra_dimension_scheduling = IntraDimensionScheduling::FIFO;
+        } else if (inp_intra_dimension_scheduling == "RG") {
+            intra_dimension_scheduling = IntraDimensionScheduling::RG;
+        } else if (inp_intra_dimension_scheduling == "smallestFirst") {
+            intra_dimension_scheduling =
+                IntraDimensionScheduling::SmallestFirst;
+        } else if (inp_intra_dimension_scheduling ==
+                   "lessRemainingPhaseFirst") {
+            intra_dimension_scheduling =
+                IntraDimensionScheduling::LessRemainingPhaseFirst;
+        } else {
+            Sys::sys_panic("unknown value for intra-dimension scheduling in "
+                           "sys input file");
+        }
+    }
+    if (j.contains("inter-dimension-scheduling")) {
+        string inp_inter_dimension_scheduling = j["inter-dimension-scheduling"];
+        if (inp_inter_dimension_scheduling == "ascending") {
+            inter_dimension_scheduling = InterDimensionScheduling::Ascending;
+        } else if (inp_inter_dimension_scheduling == "onlineGreedy") {
+            inter_dimension_scheduling = InterDimensionScheduling::OnlineGreedy;
+        } else if (inp_inter_dimension_scheduling == "roundRobin") {
+            inter_dimension_scheduling = InterDimensionScheduling::RoundRobin;
+        } else if (inp_inter_dimension_scheduling == "offlineGreedy") {
+            inter_dimension_scheduling =
+                InterDimensionScheduling::OfflineGreedy;
+        } else if (inp_inter_dimension_scheduling == "offlineGreedyFlex") {
+            inter_dimension_scheduling =
+                InterDimensionScheduling::OfflineGreedyFlex;
+        } else {
+            Sys::sys_panic("unknown value for inter-dimension scheduling in "
+                           "sys input file");
+        }
+    }
+    if (j.contains("all-reduce-implementation")) {
+        vector<string> collective_impl_str_vec = j["all-reduce-implementation"];
+        for (auto collective_impl_str : collective_impl_str_vec) {
+            CollectiveImpl* ci =
+                generate_collective_impl_from_input(collective_impl_str);
+            all_reduce_implementation_per_dimension.push_back(ci);
+        }
+    }
+    if (j.contains("reduce-scatter-implementation")) {
+        vector<string> collective_impl_str_vec =
+            j["reduce-scatter-implementation"];
+        for (auto collective_impl_str : collective_impl_str_vec) {
+            CollectiveImpl* ci =
+                generate_collective_impl_from_input(collective_impl_str);
+            reduce_scatter_implementation_per_dimension.push_back(ci);
+        }
+    }
+    if (j.contains("all-gather-implementation")) {
+        vector<string> collective_impl_str_vec = j["all-gather-implementation"];
+        for (auto collective_impl_str : collective_impl_str_vec) {
+            CollectiveImpl* ci =
+                generate_collective_impl_from_input(collective_impl_str);
+            all_gather_implementation_per_dimension.push_back(ci);
+        }
+    }
+    if (j.contains("all-to-all-implementation")) {
+        vector<string> collective_impl_str_vec = j["all-to-all-implementation"];
+        for (auto collective_impl_str : collective_impl_str_vec) {
+            CollectiveImpl* ci =
+                generate_collective_impl_from_input(collective_impl_str);
+            all_to_all_implementation_per_dimension.push_back(ci);
+        }
+    }
+    broadcast_implementation_per_dimension =
+        generate_rooted_collective_impl(
+            j.value("broadcast-implementation", vector<string>()),
+            "broadcast-implementation");
+    reduce_implementation_per_dimension =
+        generate_rooted_collective_impl(
+            j.value("reduce-implementation", vector<string>()),
+            "reduce-implementation");
+    gather_implementation_per_dimension =
+        generate_rooted_collective_impl(
+            j.value("gather-implementation", vector<string>()),
+            "gather-implementation");
+    if (j.contains("all-to-all-implementation-custom")) {
+        for (auto ci : all_to_all_implementation_per_dimension) {
+            delete ci;
+        }
+        all_to_all_implementation_per_dimension =
+            generate_custom_collective_impl(
+                j["all-to-all-implementation-custom"]);
+    }
+    if (j.contains("all-gather-implementation-custom")) {
+        for (auto ci : all_gather_implementation_per_dimension) {
+            delete ci;
+        }
+        all_gather_implementation_per_dimension =
+            generate_custom_collective_impl(
+                j["all-gather-implementation-custom"]);
+    }
+    if (j.contains("all-reduce-implementation-custom")) {
+        for (auto ci : all_reduce_implementation_per_dimension) {
+            delete ci;
+        }
+        all_reduce_implementation_per_dimension =
+            generate_custom_collective_impl(
+                j["all-reduce-implementation-custom"]);
+    }
+    if (j.contains("collective-optimization")) {
+        string inp_collective_optimization = j["collective-optimization"];
+        if (inp_collective_optimization == "baseline") {
+            collective_optimization = CollectiveOptimization::Baseline;
+        } else if (inp_collective_optimization == "localBWAware") {
+            collective_optimization = CollectiveOptimization::LocalBWAware;
+        } else {
+            Sys::sys_panic(
+                "unknown value for collective optimization in sys input file");
+        }
+    }
+    if (j.contains("local-reduction-delay")) {
+        local_reduction_delay = j["local-reduction-delay"];
+    }
+    if (j.contains("fold-processing-delay")) {
+        if (j["fold-processing-delay"] != 0) {
+            fold_processing_delay = true;
+        } else {
+            fold_processing_delay = false;
+        }
+    }
+    if (j.contains("active-chunks-per-dimension")) {
+        active_chunks_per_dimension = j["active-chunks-per-dimension"];
+    }
+    if (j.contains("L")) {
+        inp_L = j["L"];
+    }
+    if (j.contains("o")) {
+        inp_o = j["o"];
+    }
+    if (j.contains("g")) {
+        inp_g = j["g"];
+    }
+    if (j.contains("G")) {
+        inp_G = j["G"];
+    }
+    if (j.contains("endpoint-delay")) {
+        endpoint_delay_specified = true;
+        endpoint_delay = j["endpoint-delay"];
+    }
+    if (j.contains("model-shared-bus")) {
+        int inp_model_shared_bus = j["model-shared-bus"];
+        if (inp_model_shared_bus == 1) {
+            model_shared_bus = true;
+        } else {
+            model_shared_bus = false;
+        }
+    }
+    if (j.contains("shared-bus-mode")) {
+        string inp_shared_bus_mode = j["shared-bus-mode"];
+        if (inp_shared_bus_mode == "perPacket") {
+            shared_bus_mode = SharedBusMode::PerPacket;
+        } else if (inp_shared_bus_mode == "batched") {
+            shared_bus_mode = SharedBusMode::Batched;
+        } else {
+            Sys::sys_panic(
+                "unknown value for shared bus mode in sys input file");
+        }
+    }
+    if (j.contains("preferred-dataset-splits")) {
+        preferred_dataset_splits = j["preferred-dataset-splits"];
+    }
+    if (j.contains("peak-perf")) {
+        peak_perf = j["peak-perf"];
+        peak_perf = peak_perf * 1000000000000;  // TFLOPS
+    }
+    if (j.contains("local-mem-bw")) {
+        local_mem_bw = j["local-mem-bw"];
+        local_mem_bw = local_mem_bw * 1000000000;  // GB/sec
+    }
+    if (j.contains("roofline-enabled")) {
+        if (j["roofline-enabled"] != 0) {
+            roofline_enabled = true;
+        }
+    }
+    if (j.contains("trace-enabled")) {
+        if (j["trace-enabled"] != 0) {
+            trace_enabled = true;
+        } else {
+            trace_enabled = false;
+        }
+    }
+    if (j.contains("replay-only")) {
+        if (j["replay-only"] != 0) {
+            replay_only = true;
+        } else {
+            replay_only = false;
+        }
+    }
+    if (j.contains("collective-cost-cache")) {
+        if (j["collective-cost-cache"] != 0) {
+            collective_cost_cache = true;
+        } else {
+            collective_cost_cache = false;
+        }
+    }
+    if (j.contains("closed-form-collectives")) {
+        if (j["closed-form-collectives"] != 0) {
+            closed_form_collectives = true;
+        } else {
+            closed_form_collectives = false;
+        }
+    }
+    if (j.contains("synchronized-scheduling")) {
+        if (j["synchronized-scheduling"] != 0) {
+            synchronized_scheduling = true;
+        } else {
+            synchronized_scheduling = false;
+        }
+    }
+}
+
+SysConfig::~SysConfig() {
+    for (auto ci : all_reduce_implementation_per_dimension) {
+        delete ci;
+    }
+    for (auto ci : reduce_scatter_implementation_per_dimension) {
+        delete ci;
+    }
+    for (auto ci : all_gather_implementation_per_dimension) {
+        delete ci;
+    }
+    for (auto ci : all_to_all_implementation_per_dimension) {
+        delete ci;
+    }
+    for (auto ci : broadcast_implementation_per_dimension) {
+        delete ci;
+    }
+    for (auto ci : reduce_implementation_per_dimension) {
+        delete ci;
+    }
+    for (auto ci : gather_implementation_per_dimension) {
+        delete ci;
+    }
+}
+
+CollectiveImpl* SysConfig::generate_collective_impl_from_input(
+    string collective_impl_str) {
+    if (collective_impl_str == "ring") {
+        return new CollectiveImpl(CollectiveImplType::Ring);
+    } else if (collective_impl_str == "mesh") {
+        return new CollectiveImpl(CollectiveImplType::Mesh);
+    } else if (collective_impl_str == "hypercube") {
+        return new CollectiveImpl(CollectiveImplType::HyperCube);
+    } else if (collective_impl_str == "bidirectionalRing") {
+        return new CollectiveImpl(CollectiveImplType::BidirectionalRing);
+    } else if (collective_impl_str == "swing") {
+        return new CollectiveImpl(CollectiveImplType::Swing);
+    } else if (collective_impl_str == "inNetwork") {
+        return new CollectiveImpl(CollectiveImplType::InNetwork);
+    } else if (collective_impl_str == "oneRing") {
+        return new CollectiveImpl(CollectiveImplType::OneRing);
+    } else if (collective_impl_str == "doubleBinaryTree") {
+        return new CollectiveImpl(CollectiveImplType::DoubleBinaryTree);
+    } else if (collective_impl_str.rfind("direct", 0) == 0) {
+        int window = -1;
+        if (collective_impl_str != "direct") {
+            window = stoi(collective_impl_str.substr(6, 5));
+        }
+        return new DirectCollectiveImpl(CollectiveImplType::Direct, window);
+    } else if (collective_impl_str.rfind("oneDirect", 0) == 0) {
+        int window = -1;
+        if (collective_impl_str != "oneDirect") {
+            window = stoi(collective_impl_str.substr(9, 5));
+        }
+        return new DirectCollectiveImpl(CollectiveImplType::OneDirect, window);
+    } else if (collective_impl_str == "halvingDoubling") {
+        return new CollectiveImpl(CollectiveImplType::HalvingDoubling);
+    } else if (collective_impl_str == "oneHalvingDoubling") {
+        return new CollectiveImpl(CollectiveImplType::OneHalvingDoubling);
+    } else if (collective_impl_str == "binomialTree") {
+        return new CollectiveImpl(CollectiveImplType::BinomialTree);
+    } else if (collective_impl_str.rfind("pipelinedTree", 0) == 0) {
+        int sub_chunks = 4;
+        if (collective_impl_str != "pipelinedTree") {
+            sub_chunks = stoi(collective_impl_str.substr(13, 5));
+        }
+        return new PipelinedTreeCollectiveImpl(sub_chunks);
+    } else {
+        Sys::sys_panic("Cannot interpret collective implementations. Please "
+                       "check the collective implementations in the sys"
+                       "input file");
+        return new CollectiveImpl(CollectiveImplType::Ring);
+    }
+}
+
+// Broadcast, reduce and gather are rooted and can only be implemented as a
+// chain along the ring or as a binomial tree. Without an entry in the input
+// file, every dimension of the all-reduce uses the ring.
+vector<CollectiveImpl*> SysConfig::generate_rooted_collective_impl(
+    vector<string> collective_impl_str_vec, string key) const {
+    vector<CollectiveImpl*> result;
+    if (collective_impl_str_vec.empty()) {
+        for (uint64_t dim = 0;
+             dim < all_reduce_implementation_per_dimension.size(); dim++) {
+            result.push_back(new CollectiveImpl(CollectiveImplType::Ring));
+        }
+        return result;
+    }
+    for (auto collective_impl_str : collective_impl_str_vec) {
+        CollectiveImpl* ci =
+            generate_collective_impl_from_input(collective_impl_str);
+        if (ci->type != CollectiveImplType::Ring &&
+            ci->type != CollectiveImplType::OneRing &&
+            ci->type != CollectiveImplType::BinomialTree) {
+            Sys::sys_panic("only ring, oneRing and binomialTree can be used "
+                           "as " + key + " in sys input file");
+        }
+        result.push_back(ci);
+    }
+    return result;
+}
+
+// The Chakra ET path given in the input file is shared by all ranks, each Sys
+// appends its own id to it when it copies the implementation.
+vector<CollectiveImpl*> SysConfig::generate_custom_collective_impl(
+    vector<string> chakra_filepath_str_vec) {
+    if (chakra_filepath_str_vec.size() != 1) {
+        throw logic_error(
+            "There should be 1 Chakra ET only. In multi-dim collectives, "
+            "that 1 ET file covers all dimensions");
+    }
+    vector<CollectiveImpl*> result;
+    result.push_back(new ChakraCollectiveImpl(CollectiveImplType::ChakraImpl,
+                                              chakra_filepath_str_vec[0]));
+    return result;
+}
+
+}  // namespace AstraSim
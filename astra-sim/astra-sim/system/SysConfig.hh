@@ -0,0 +1,85 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#ifndef __SYS_CONFIG_HH__
+#define __SYS_CONFIG_HH__
+
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "astra-sim/system/Common.hh"
+
+namespace AstraSim {
+
+/*
+ * SysConfig holds the system layer input (system.json). The file is parsed
+ * once and the resulting configuration is shared, read-only, by every Sys
+ * that is created with the same input file.
+ */
+class SysConfig {
+  public:
+    // returns nullptr if the input file can not be opened
+    static std::shared_ptr<const SysConfig> get(std::string name);
+    // drops the parsed inputs, the Sys still holding one keep it alive
+    static void clear();
+    ~SysConfig();
+
+    SchedulingPolicy scheduling_policy;
+    IntraDimensionScheduling intra_dimension_scheduling;
+    InterDimensionScheduling inter_dimension_scheduling;
+    CollectiveOptimization collective_optimization;
+
+    // Collective implementations as given in the input file. Each Sys works
+    // on its own copies of them.
+    std::vector<CollectiveImpl*> all_reduce_implementation_per_dimension;
+    std::vector<CollectiveImpl*> reduce_scatter_implementation_per_dimension;
+    std::vector<CollectiveImpl*> all_gather_implementation_per_dimension;
+    std::vector<CollectiveImpl*> all_to_all_implementation_per_dimension;
+    std::vector<CollectiveImpl*> broadcast_implementation_per_dimension;
+    std::vector<CollectiveImpl*> reduce_implementation_per_dimension;
+    std::vector<CollectiveImpl*> gather_implementation_per_dimension;
+
+    int local_reduction_delay;
+    bool fold_processing_delay;
+    int active_chunks_per_dimension;
+    float inp_L;
+    float inp_o;
+    float inp_g;
+    float inp_G;
+    // the endpoint delay is scaled by each Sys' injection scale, but only
+    // when it is given in the input file
+    bool endpoint_delay_specified;
+    int endpoint_delay;
+    bool model_shared_bus;
+    SharedBusMode shared_bus_mode;
+    int preferred_dataset_splits;
+    double peak_perf;
+    double local_mem_bw;
+    bool roofline_enabled;
+    bool trace_enabled;
+    bool replay_only;
+    bool collective_cost_cache;
+    bool closed_form_collectives;
+    bool synchronized_scheduling;
+
+  private:
+    SysConfig(std::ifstream& inFile);
+    static CollectiveImpl* generate_collective_impl_from_input(
+        std::string collective_impl_str);
+    std::vector<CollectiveImpl*> generate_rooted_collective_impl(
+        std::vector<std::string> collective_impl_str_vec,
+        std::string key) const;
+    static std::vector<CollectiveImpl*> generate_custom_collective_impl(
+        std::vector<std::string> chakra_filepath_str_vec);
+
+    static std::map<std::string, std::shared_ptr<const SysConfig>> configs;
+};
+
+}  // namespace AstraSim
+
+#endif /* __SYS_CONFIG_HH__ */
@@ -17,6 +17,10 @@ void Algorithm::init(BaseStream* stream) {
 
 void Algorithm::call(EventType event, CallData* data) {}
 
+bool Algorithm::get_closed_form_duration(Sys* sys, Tick& duration) {
+    return false;
+}
+
 void Algorithm::exit() {
     stream->owner->proceed_to_next_vnet_baseline((StreamBaseline*)stream);
 }
@@ -21,7 +21,13 @@ class Algorithm : public Callable {
         AllToAll,
         HalvingDoubling,
         Mesh,
-        HyperCube
+        HyperCube,
+        RootedRing,
+        BinomialTree,
+        PipelinedTree,
+        BidirectionalRing,
+        Swing,
+        InNetwork
     };
 
     Algorithm();
@@ -30,6 +36,10 @@ class Algorithm : public Callable {
     virtual void init(BaseStream* stream);
     virtual void call(EventType event, CallData* data);
     virtual void exit();
+    // Duration of the phase on this rank computed from the parameters of the
+    // algorithm, without any events. Returns false if the phase has to be
+    // simulated.
+    virtual bool get_closed_form_duration(Sys* sys, Tick& duration);
 
     Name name;
     int id;
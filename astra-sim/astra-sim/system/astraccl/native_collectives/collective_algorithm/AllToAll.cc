@@ -5,6 +5,10 @@ LICENSE file in the root directory of this source tree.
 
 #include "astra-sim/system/astraccl/native_collectives/collective_algorithm/AllToAll.hh"
 
+#include <algorithm>
+
+#include "astra-sim/system/Sys.hh"
+
 using namespace AstraSim;
 
 AllToAll::AllToAll(ComType type,
@@ -27,6 +31,41 @@ AllToAll::AllToAll(ComType type,
     }
 }
 
+bool AllToAll::get_closed_form_duration(Sys* sys, Tick& duration) {
+    // up to parallel_reduce messages are in flight at once, each to the next
+    // peer in ring order, so a wave of messages takes as long as its farthest
+    // peer
+    if (!sys->get_closed_form_bus_delay(transmition, duration)) {
+        return false;
+    }
+    RingTopology* ring_topology = (RingTopology*)logical_topo;
+    int index = ring_topology->get_index_in_ring();
+    for (int message = 0; message < stream_count;
+         message += parallel_reduce) {
+        Tick wave_time = 0;
+        for (int i = message;
+             i < message + parallel_reduce && i < stream_count; i++) {
+            int distance = 1 + i % (nodes_in_ring - 1);
+            if (direction == RingTopology::Direction::Anticlockwise) {
+                distance = nodes_in_ring - distance;
+            }
+            int peer =
+                ring_topology->get_id((index + distance) % nodes_in_ring);
+            bool reduce = comType == ComType::Reduce_Scatter ||
+                          (comType == ComType::All_Reduce &&
+                           i < middle_point);
+            Tick step_time = 0;
+            if (!sys->get_closed_form_step_time(peer, msg_size, reduce,
+                                                transmition, step_time)) {
+                return false;
+            }
+            wave_time = std::max(wave_time, step_time);
+        }
+        duration += wave_time;
+    }
+    return true;
+}
+
 void AllToAll::run(EventType event, CallData* data) {
     if (event == EventType::General) {
         free_packets += 1;
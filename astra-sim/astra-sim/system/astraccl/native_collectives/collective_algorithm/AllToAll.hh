@@ -22,6 +22,7 @@ class AllToAll : public Ring {
              RingTopology::Direction direction,
              InjectionPolicy injection_policy);
     void run(EventType event, CallData* data);
+    bool get_closed_form_duration(Sys* sys, Tick& duration);
     void process_max_count();
     int get_non_zero_latency_packets();
     int middle_point;
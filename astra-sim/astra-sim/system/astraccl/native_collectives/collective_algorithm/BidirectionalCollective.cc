@@ -0,0 +1,195 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/BidirectionalCollective.hh"
+
+#include <algorithm>
+
+#include "astra-sim/system/PacketBundle.hh"
+
+using namespace AstraSim;
+
+BidirectionalCollective::BidirectionalCollective(ComType type,
+                                                 int id,
+                                                 RingTopology* ring_topology,
+                                                 uint64_t data_size)
+    : Algorithm() {
+    this->comType = type;
+    this->id = id;
+    this->logical_topo = ring_topology;
+    this->ring_topology = ring_topology;
+    this->data_size = data_size;
+    this->nodes_in_ring = ring_topology->get_nodes_in_ring();
+    this->busy = false;
+    this->finished_lanes = 0;
+    if (ring_topology->get_dimension() == RingTopology::Dimension::Local) {
+        transmition = MemBus::Transmition::Fast;
+    } else {
+        transmition = MemBus::Transmition::Usual;
+    }
+    if (type != ComType::All_Reduce && type != ComType::Reduce_Scatter &&
+        type != ComType::All_Gather) {
+        Sys::sys_panic("bidirectional collectives only implement all-reduce, "
+                       "reduce-scatter and all-gather");
+    }
+    this->final_data_size = get_final_data_size(type, data_size, nodes_in_ring);
+}
+
+uint64_t BidirectionalCollective::get_final_data_size(ComType type,
+                                                      uint64_t data_size,
+                                                      int nodes) {
+    switch (type) {
+    case ComType::Reduce_Scatter:
+        return data_size / nodes;
+    case ComType::All_Gather:
+        return data_size * nodes;
+    default:
+        return data_size;
+    }
+}
+
+uint64_t BidirectionalCollective::get_lane_size() {
+    if (comType == ComType::All_Gather) {
+        return data_size * nodes_in_ring / 2;
+    }
+    return data_size / 2;
+}
+
+int BidirectionalCollective::get_lane_tag(int lane) {
+    // with two nodes in the ring both lanes exchange messages with the same
+    // peer, so the second lane uses the upper half of the collective tags
+    return stream->stream_id +
+           lane * ((Sys::FrontEndSendRecvType::RENDEZVOUS -
+                    Sys::FrontEndSendRecvType::COLLECTIVE) /
+                   2);
+}
+
+bool BidirectionalCollective::get_closed_form_duration(Sys* sys,
+                                                       Tick& duration) {
+    // the lanes use opposite link directions, but share the serialized local
+    // memory transfers, so the task queue is replayed in arrival order
+    Tick bus_delay = 0;
+    if (!sys->get_closed_form_bus_delay(transmition, bus_delay)) {
+        return false;
+    }
+    std::vector<Tick> network[2], local[2];
+    for (int lane = 0; lane < 2; lane++) {
+        for (Step& s : lanes[lane]) {
+            Tick send_time = 0, step_time = 0;
+            if (!sys->get_closed_form_step_time(s.send_to, s.size, false,
+                                                transmition, send_time) ||
+                !sys->get_closed_form_step_time(s.send_to, s.size, s.reduce,
+                                                transmition, step_time)) {
+                return false;
+            }
+            network[lane].push_back(send_time - bus_delay);
+            local[lane].push_back(step_time - network[lane].back());
+        }
+    }
+    Tick ready[2] = {0, 0};
+    int next[2] = {-1, -1};
+    bool done[2] = {false, false};
+    Tick free = 0;
+    duration = 0;
+    while (!done[0] || !done[1]) {
+        int lane = done[0] || (!done[1] && ready[1] < ready[0]) ? 1 : 0;
+        Tick end = std::max(free, ready[lane]) +
+                   (next[lane] < 0 ? bus_delay : local[lane][next[lane]]);
+        free = end;
+        if (++next[lane] < (int)lanes[lane].size()) {
+            ready[lane] = end + network[lane][next[lane]];
+        } else {
+            done[lane] = true;
+            duration = std::max(duration, end);
+        }
+    }
+    return true;
+}
+
+void BidirectionalCollective::start_step(int lane, int step) {
+    Step& s = lanes[lane][step];
+    sim_request snd_req;
+    snd_req.srcRank = stream->owner->id;
+    snd_req.dstRank = s.send_to;
+    snd_req.tag = get_lane_tag(lane);
+    snd_req.reqType = UINT8;
+    snd_req.vnet = this->stream->current_queue_id;
+    stream->owner->front_end_sim_send(
+        0, Sys::dummy_data, s.size, UINT8, s.send_to, get_lane_tag(lane),
+        &snd_req, Sys::FrontEndSendRecvType::COLLECTIVE, &Sys::handleEvent,
+        nullptr);
+    sim_request rcv_req;
+    rcv_req.vnet = this->stream->current_queue_id;
+    RecvPacketEventHandlerData* ehd = new RecvPacketEventHandlerData(
+        stream, stream->owner->id, EventType::PacketReceived,
+        stream->current_queue_id, stream->stream_id);
+    pending_recvs[ehd] = {lane, step};
+    stream->owner->front_end_sim_recv(
+        0, Sys::dummy_data, s.size, UINT8, s.recv_from, get_lane_tag(lane),
+        &rcv_req, Sys::FrontEndSendRecvType::COLLECTIVE, &Sys::handleEvent,
+        ehd);
+}
+
+void BidirectionalCollective::enqueue(int lane, int step) {
+    tasks.push_back({lane, step});
+    if (!busy) {
+        start_next_task();
+    }
+}
+
+void BidirectionalCollective::start_next_task() {
+    busy = true;
+    int lane = tasks.front().first;
+    int step = tasks.front().second;
+    if (step < 0) {
+        uint64_t size = lanes[lane].empty() ? 0 : lanes[lane][0].size;
+        (new PacketBundle(stream->owner, stream, false, false, size,
+                          transmition))
+            ->send_to_MA();
+    } else {
+        // the received data goes back to the network interface if a later
+        // step forwards it
+        bool send_back = step + 1 < (int)lanes[lane].size();
+        (new PacketBundle(stream->owner, stream, lanes[lane][step].reduce,
+                          send_back, lanes[lane][step].size, transmition))
+            ->send_to_NPU();
+    }
+}
+
+void BidirectionalCollective::run(EventType event, CallData* data) {
+    if (event == EventType::StreamInit) {
+        enqueue(0, -1);
+        enqueue(1, -1);
+
+    } else if (event == EventType::PacketReceived) {
+        RecvPacketEventHandlerData* ehd = (RecvPacketEventHandlerData*)data;
+        auto it = pending_recvs.find(ehd);
+        if (it == pending_recvs.end()) {
+            Sys::sys_panic("bidirectional collective received an unexpected "
+                           "message");
+        }
+        std::pair<int, int> task = it->second;
+        pending_recvs.erase(it);
+        enqueue(task.first, task.second);
+
+    } else if (event == EventType::General) {
+        int lane = tasks.front().first;
+        int next_step = tasks.front().second + 1;
+        tasks.pop_front();
+        busy = false;
+        if (next_step < (int)lanes[lane].size()) {
+            start_step(lane, next_step);
+        } else {
+            finished_lanes++;
+        }
+        if (finished_lanes == 2) {
+            exit();
+            return;
+        }
+        if (!tasks.empty()) {
+            start_next_task();
+        }
+    }
+}
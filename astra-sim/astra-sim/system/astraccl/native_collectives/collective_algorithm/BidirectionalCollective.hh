@@ -0,0 +1,78 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#ifndef __BIDIRECTIONAL_COLLECTIVE_HH__
+#define __BIDIRECTIONAL_COLLECTIVE_HH__
+
+#include <deque>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "astra-sim/system/MemBus.hh"
+#include "astra-sim/system/RecvPacketEventHandlerData.hh"
+#include "astra-sim/system/astraccl/Algorithm.hh"
+#include "astra-sim/system/astraccl/native_collectives/logical_topology/RingTopology.hh"
+
+namespace AstraSim {
+
+/*
+ * BidirectionalCollective runs an all-reduce, reduce-scatter or all-gather as
+ * two independent lanes that each carry half of the data, one per link
+ * direction, so both directions of the dimension inject traffic. Within a
+ * lane, every step sends a message, waits for the matching message of the
+ * step, optionally reduces it, and only then starts the next step. The
+ * subclasses only decide on the peers and the message sizes of the steps.
+ */
+class BidirectionalCollective : public Algorithm {
+  public:
+    struct Step {
+        int send_to;
+        int recv_from;
+        uint64_t size;
+        bool reduce;
+    };
+
+    BidirectionalCollective(ComType type,
+                            int id,
+                            RingTopology* ring_topology,
+                            uint64_t data_size);
+    void run(EventType event, CallData* data);
+    bool get_closed_form_duration(Sys* sys, Tick& duration);
+    // final data size of the collective, also used to plan the following
+    // phases before the algorithm is created
+    static uint64_t get_final_data_size(ComType type,
+                                        uint64_t data_size,
+                                        int nodes);
+
+  protected:
+    // size of the whole vector the collective works on, split over the lanes
+    uint64_t get_lane_size();
+
+    RingTopology* ring_topology;
+    int nodes_in_ring;
+    std::vector<Step> lanes[2];
+
+  private:
+    void start_step(int lane, int step);
+    // each lane sends and receives with its own tag, so the messages of the
+    // lanes never match each other's receives
+    int get_lane_tag(int lane);
+    // the local memory transfers are serialized, so each General event
+    // finishes the (lane, step) task at the front of the queue; step -1 moves
+    // the initial data of the lane to the network interface
+    void enqueue(int lane, int step);
+    void start_next_task();
+
+    MemBus::Transmition transmition;
+    std::map<RecvPacketEventHandlerData*, std::pair<int, int>> pending_recvs;
+    std::deque<std::pair<int, int>> tasks;
+    bool busy;
+    int finished_lanes;
+};
+
+}  // namespace AstraSim
+
+#endif /* __BIDIRECTIONAL_COLLECTIVE_HH__ */
@@ -0,0 +1,35 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/BidirectionalRing.hh"
+
+using namespace AstraSim;
+
+BidirectionalRing::BidirectionalRing(ComType type,
+                                     int id,
+                                     RingTopology* ring_topology,
+                                     uint64_t data_size)
+    : BidirectionalCollective(type, id, ring_topology, data_size) {
+    this->name = Name::BidirectionalRing;
+    int steps = nodes_in_ring - 1;
+    if (type == ComType::All_Reduce) {
+        steps *= 2;
+    }
+    uint64_t msg_size = get_lane_size() / nodes_in_ring;
+    RingTopology::Direction directions[2] = {
+        RingTopology::Direction::Clockwise,
+        RingTopology::Direction::Anticlockwise};
+    for (int lane = 0; lane < 2; lane++) {
+        int receiver = ring_topology->get_receiver(id, directions[lane]);
+        int sender = ring_topology->get_sender(id, directions[lane]);
+        for (int step = 0; step < steps; step++) {
+            // all-reduce reduces in its first n - 1 steps and gathers after
+            bool reduce = type == ComType::Reduce_Scatter ||
+                          (type == ComType::All_Reduce &&
+                           step < nodes_in_ring - 1);
+            lanes[lane].push_back({receiver, sender, msg_size, reduce});
+        }
+    }
+}
@@ -0,0 +1,28 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#ifndef __BIDIRECTIONAL_RING_HH__
+#define __BIDIRECTIONAL_RING_HH__
+
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/BidirectionalCollective.hh"
+
+namespace AstraSim {
+
+/*
+ * BidirectionalRing runs the ring algorithm on both halves of the data at the
+ * same time, the first half clockwise and the second half anticlockwise, so
+ * that both link directions of the ring carry traffic.
+ */
+class BidirectionalRing : public BidirectionalCollective {
+  public:
+    BidirectionalRing(ComType type,
+                      int id,
+                      RingTopology* ring_topology,
+                      uint64_t data_size);
+};
+
+}  // namespace AstraSim
+
+#endif /* __BIDIRECTIONAL_RING_HH__ */
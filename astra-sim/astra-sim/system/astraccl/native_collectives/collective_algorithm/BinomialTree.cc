@@ -0,0 +1,71 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/BinomialTree.hh"
+
+#include <algorithm>
+
+using namespace AstraSim;
+
+BinomialTree::BinomialTree(ComType type,
+                           int id,
+                           RingTopology* ring_topology,
+                           uint64_t data_size,
+                           int root)
+    : RootedCollective(type, id, ring_topology, data_size, root) {
+    this->name = Name::BinomialTree;
+    RingTopology::Direction direction = RingTopology::Direction::Clockwise;
+    int distance = get_distance(direction);
+
+    // The parent of a node clears the lowest set bit of its distance from the
+    // root, and its children are the nodes at distance + 2^k below that bit.
+    int span = 1;
+    while (span < nodes_in_ring && (distance & span) == 0) {
+        span <<= 1;
+    }
+    int parent = distance > 0 ? distance - span : -1;
+    uint64_t subtree_size = std::min(span, nodes_in_ring - distance);
+
+    // children with the largest subtree come first
+    std::vector<std::pair<int, uint64_t>> children;
+    for (int step = span >> 1; step > 0; step >>= 1) {
+        int child = distance + step;
+        if (child < nodes_in_ring) {
+            children.push_back({get_peer(child, direction),
+                                std::min(step, nodes_in_ring - child)});
+        }
+    }
+
+    switch (type) {
+    case ComType::Broadcast:
+        if (parent >= 0) {
+            recv_from.push_back({get_peer(parent, direction), data_size});
+        }
+        for (auto& child : children) {
+            send_to.push_back({child.first, data_size});
+        }
+        break;
+    case ComType::Reduce:
+        for (auto& child : children) {
+            recv_from.push_back({child.first, data_size});
+        }
+        if (parent >= 0) {
+            send_to.push_back({get_peer(parent, direction), data_size});
+        }
+        break;
+    case ComType::Gather:
+        for (auto& child : children) {
+            recv_from.push_back({child.first, data_size * child.second});
+        }
+        if (parent >= 0) {
+            send_to.push_back(
+                {get_peer(parent, direction), data_size * subtree_size});
+        }
+        break;
+    default:
+        Sys::sys_panic("binomial tree only implements broadcast, reduce and "
+                       "gather");
+    }
+}
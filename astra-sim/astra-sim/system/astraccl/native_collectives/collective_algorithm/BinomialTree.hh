@@ -0,0 +1,29 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#ifndef __BINOMIAL_TREE_HH__
+#define __BINOMIAL_TREE_HH__
+
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/RootedCollective.hh"
+
+namespace AstraSim {
+
+/*
+ * BinomialTree runs broadcast, reduce and gather over a binomial tree that is
+ * rooted at the root and laid over the ring order, so the collective takes
+ * ceil(log2(n)) steps instead of the n - 1 steps of the ring chain.
+ */
+class BinomialTree : public RootedCollective {
+  public:
+    BinomialTree(ComType type,
+                 int id,
+                 RingTopology* ring_topology,
+                 uint64_t data_size,
+                 int root);
+};
+
+}  // namespace AstraSim
+
+#endif /* __BINOMIAL_TREE_HH__ */
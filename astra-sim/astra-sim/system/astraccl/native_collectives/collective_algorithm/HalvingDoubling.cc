@@ -53,19 +53,16 @@ HalvingDoubling::HalvingDoubling(ComType type,
     remained_packets_per_max_count = 1;
     switch (type) {
     case ComType::All_Reduce:
-        this->final_data_size = data_size;
         this->msg_size = data_size / 2;
         this->rank_offset = 1;
         this->offset_multiplier = 2;
         break;
     case ComType::All_Gather:
-        this->final_data_size = data_size * nodes_in_ring;
         this->msg_size = data_size;
         this->rank_offset = nodes_in_ring / 2;
         this->offset_multiplier = 0.5;
         break;
     case ComType::Reduce_Scatter:
-        this->final_data_size = data_size / nodes_in_ring;
         this->msg_size = data_size / 2;
         this->rank_offset = 1;
         this->offset_multiplier = 2;
@@ -77,6 +74,7 @@ HalvingDoubling::HalvingDoubling(ComType type,
                 "HalvingDoubling collective algorithm #########");
         std::exit(1);
     }
+    this->final_data_size = get_final_data_size(type, data_size, nodes_in_ring);
     RingTopology::Direction direction = specify_direction();
     this->curr_receiver = id;
     for (int i = 0; i < rank_offset; i++) {
@@ -86,10 +84,74 @@ HalvingDoubling::HalvingDoubling(ComType type,
     }
 }
 
+bool HalvingDoubling::get_closed_form_duration(Sys* sys, Tick& duration) {
+    // replays how process_max_count walks the peers and message sizes: each
+    // step sends the packet inserted last and the received message is
+    // inserted as the next packet, with the next message size
+    if (!sys->get_closed_form_bus_delay(transmition, duration)) {
+        return false;
+    }
+    RingTopology* ring_topology = (RingTopology*)logical_topo;
+    int index = ring_topology->get_index_in_ring();
+    int offset = rank_offset;
+    double multiplier = offset_multiplier;
+    uint64_t size = msg_size;
+    // packets are inserted in groups of one unprocessed packet followed by
+    // get_non_zero_latency_packets() packets, which are reduced in every
+    // group of a reduce-scatter and every other group of an all-reduce
+    int group_size = 1 + get_non_zero_latency_packets();
+    for (int step = 0; step < stream_count; step++) {
+        RingTopology::Direction direction = RingTopology::Direction::Clockwise;
+        if (offset != 0 && (index / offset) % 2 != 0) {
+            direction = RingTopology::Direction::Anticlockwise;
+        }
+        int peer = id;
+        for (int i = 0; i < offset; i++) {
+            peer = ring_topology->get_receiver(peer, direction);
+        }
+        uint64_t sent_size = size;
+        offset *= multiplier;
+        size /= multiplier;
+        if (offset == nodes_in_ring && comType == ComType::All_Reduce) {
+            multiplier = 0.5;
+            offset *= multiplier;
+            size /= multiplier;
+        }
+        int packet = step + 1;
+        bool reduce = packet % group_size != 0 &&
+                      (comType == ComType::Reduce_Scatter ||
+                       (comType == ComType::All_Reduce &&
+                        (packet / group_size) % 2 == 0));
+        Tick step_time = 0;
+        if (!sys->get_closed_form_step_time(peer, sent_size, false,
+                                            transmition, step_time)) {
+            return false;
+        }
+        duration += step_time;
+        if (reduce) {
+            duration += PacketBundle::get_processing_delay(sys, size);
+        }
+    }
+    return true;
+}
+
 int HalvingDoubling::get_non_zero_latency_packets() {
     return log2(nodes_in_ring) - 1 * parallel_reduce;
 }
 
+uint64_t HalvingDoubling::get_final_data_size(ComType type,
+                                              uint64_t data_size,
+                                              int nodes) {
+    switch (type) {
+    case ComType::All_Gather:
+        return data_size * nodes;
+    case ComType::Reduce_Scatter:
+        return data_size / nodes;
+    default:
+        return data_size;
+    }
+}
+
 RingTopology::Direction HalvingDoubling::specify_direction() {
     if (rank_offset == 0) {
         return RingTopology::Direction::Clockwise;
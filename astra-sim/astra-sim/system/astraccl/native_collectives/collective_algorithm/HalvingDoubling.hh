@@ -22,6 +22,12 @@ class HalvingDoubling : public Algorithm {
                     RingTopology* ring_topology,
                     uint64_t data_size);
     virtual void run(EventType event, CallData* data);
+    // final data size of the collective, also used to plan the following
+    // phases before the algorithm is created
+    static uint64_t get_final_data_size(ComType type,
+                                        uint64_t data_size,
+                                        int nodes);
+    virtual bool get_closed_form_duration(Sys* sys, Tick& duration);
     RingTopology::Direction specify_direction();
     void process_stream_count();
     void release_packets();
@@ -71,27 +71,38 @@ HyperCube::HyperCube(ComType type,
     }
     remained_packets_per_message = 1;
     remained_packets_per_max_count = 1;
+    this->final_data_size =
+        get_final_data_size(type, data_size, nodes_in_hypercube);
     switch (type) {
     case ComType::All_Reduce:
-        this->final_data_size = data_size;
         this->msg_size = data_size / nodes_in_hypercube;
         break;
     case ComType::All_Gather:
-        this->final_data_size = data_size * nodes_in_hypercube;
         this->msg_size = data_size;
         break;
     case ComType::Reduce_Scatter:
-        this->final_data_size = data_size / nodes_in_hypercube;
         this->msg_size = data_size / nodes_in_hypercube;
         break;
     case ComType::All_to_All:
-        this->final_data_size = data_size;
         this->msg_size = data_size / nodes_in_hypercube;
         break;
     default:;
     }
 }
 
+uint64_t HyperCube::get_final_data_size(ComType type,
+                                        uint64_t data_size,
+                                        int nodes) {
+    switch (type) {
+    case ComType::All_Gather:
+        return data_size * nodes;
+    case ComType::Reduce_Scatter:
+        return data_size / nodes;
+    default:
+        return data_size;
+    }
+}
+
 int HyperCube::get_non_zero_latency_packets() {
     return (nodes_in_hypercube - 1) * parallel_reduce * 1;
 }
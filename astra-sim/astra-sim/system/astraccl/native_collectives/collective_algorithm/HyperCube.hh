@@ -22,6 +22,11 @@ class HyperCube : public Algorithm {
               HyperCubeTopology::Direction direction,
               InjectionPolicy injection_policy);
     virtual void run(EventType event, CallData* data);
+    // final data size of the collective, also used to plan the following
+    // phases before the algorithm is created
+    static uint64_t get_final_data_size(ComType type,
+                                        uint64_t data_size,
+                                        int nodes);
     void process_stream_count();
     void release_packets();
     virtual void process_max_count();
@@ -0,0 +1,64 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/InNetworkAllReduce.hh"
+
+#include "astra-sim/system/PacketBundle.hh"
+#include "astra-sim/system/RecvPacketEventHandlerData.hh"
+
+using namespace AstraSim;
+
+InNetworkAllReduce::InNetworkAllReduce(int id,
+                                       RingTopology* ring_topology,
+                                       uint64_t data_size)
+    : Algorithm() {
+    this->id = id;
+    this->logical_topo = ring_topology;
+    this->data_size = data_size;
+    this->final_data_size = data_size;
+    this->comType = ComType::All_Reduce;
+    this->name = Name::InNetwork;
+    this->state = State::Begin;
+    if (ring_topology->get_dimension() == RingTopology::Dimension::Local) {
+        transmition = MemBus::Transmition::Fast;
+    } else {
+        transmition = MemBus::Transmition::Usual;
+    }
+    for (int index = 0; index < ring_topology->get_nodes_in_ring(); index++) {
+        ranks.push_back(ring_topology->get_id(index));
+    }
+}
+
+void InNetworkAllReduce::run(EventType event, CallData* data) {
+    if (state == State::Begin && event == EventType::StreamInit) {
+        state = State::Reducing;
+        (new PacketBundle(stream->owner, stream, false, false, data_size,
+                          transmition))
+            ->send_to_MA();
+
+    } else if (state == State::Reducing && event == EventType::General) {
+        state = State::WaitingForResult;
+        RecvPacketEventHandlerData* ehd = new RecvPacketEventHandlerData(
+            stream, stream->owner->id, EventType::PacketReceived,
+            stream->current_queue_id, stream->stream_id);
+        if (stream->owner->front_end_sim_switch_reduce(
+                data_size, ranks, stream->stream_id, &Sys::handleEvent, ehd) <
+            0) {
+            Sys::sys_panic("in-network all-reduce needs a network backend "
+                           "that reduces in the switch, and all nodes of the "
+                           "dimension attached to the same switch");
+        }
+
+    } else if (state == State::WaitingForResult &&
+               event == EventType::PacketReceived) {
+        state = State::End;
+        (new PacketBundle(stream->owner, stream, false, false, data_size,
+                          transmition))
+            ->send_to_NPU();
+
+    } else if (state == State::End && event == EventType::General) {
+        exit();
+    }
+}
@@ -0,0 +1,40 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#ifndef __IN_NETWORK_ALL_REDUCE_HH__
+#define __IN_NETWORK_ALL_REDUCE_HH__
+
+#include <vector>
+
+#include "astra-sim/system/MemBus.hh"
+#include "astra-sim/system/astraccl/Algorithm.hh"
+#include "astra-sim/system/astraccl/native_collectives/logical_topology/RingTopology.hh"
+
+namespace AstraSim {
+
+/*
+ * InNetworkAllReduce offloads the all-reduce of one dimension to the switch
+ * the nodes of the dimension are attached to, like SHARP or NVLS. Every node
+ * sends its data to the switch once and receives the reduced data once, so
+ * each link carries the data once per direction instead of the 2(n - 1)/n
+ * times of the ring. The network backend has to support
+ * AstraNetworkAPI::sim_switch_reduce.
+ */
+class InNetworkAllReduce : public Algorithm {
+  public:
+    enum class State { Begin = 0, Reducing, WaitingForResult, End };
+
+    InNetworkAllReduce(int id, RingTopology* ring_topology, uint64_t data_size);
+    void run(EventType event, CallData* data);
+
+  private:
+    State state;
+    MemBus::Transmition transmition;
+    std::vector<int> ranks;
+};
+
+}  // namespace AstraSim
+
+#endif /* __IN_NETWORK_ALL_REDUCE_HH__ */
@@ -0,0 +1,181 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/PipelinedTreeAllReduce.hh"
+
+#include "astra-sim/system/PacketBundle.hh"
+
+using namespace AstraSim;
+
+PipelinedTreeAllReduce::PipelinedTreeAllReduce(int id,
+                                               RingTopology* ring_topology,
+                                               uint64_t data_size,
+                                               int sub_chunks)
+    : Algorithm() {
+    this->id = id;
+    this->logical_topo = ring_topology;
+    this->ring_topology = ring_topology;
+    this->data_size = data_size;
+    this->final_data_size = data_size;
+    this->comType = ComType::All_Reduce;
+    this->name = Name::PipelinedTree;
+    if ((uint64_t)sub_chunks > data_size) {
+        sub_chunks = data_size;
+    }
+    this->sub_chunks = sub_chunks > 0 ? sub_chunks : 1;
+    if (ring_topology->get_dimension() == RingTopology::Dimension::Local) {
+        transmition = MemBus::Transmition::Fast;
+    } else {
+        transmition = MemBus::Transmition::Usual;
+    }
+
+    // heap layout over the ring indices: the children of index i are 2i + 1
+    // and 2i + 2
+    int nodes_in_ring = ring_topology->get_nodes_in_ring();
+    int index = ring_topology->get_index_in_ring();
+    parent = index > 0 ? ring_topology->get_id((index - 1) / 2) : -1;
+    for (int child = 2 * index + 1;
+         child <= 2 * index + 2 && child < nodes_in_ring; child++) {
+        children.push_back(ring_topology->get_id(child));
+    }
+    received_from_child.resize(children.size(), 0);
+    received_from_parent = 0;
+    reduced = 0;
+    finished = 0;
+    busy = false;
+}
+
+uint64_t PipelinedTreeAllReduce::get_sub_chunk_size(int sub_chunk) {
+    uint64_t size = data_size / sub_chunks;
+    if ((uint64_t)sub_chunk < data_size % sub_chunks) {
+        size++;
+    }
+    return size;
+}
+
+void PipelinedTreeAllReduce::post_recv(int slot) {
+    int peer = slot < 0 ? parent : children[slot];
+    int sub_chunk = slot < 0 ? received_from_parent : received_from_child[slot];
+    sim_request rcv_req;
+    rcv_req.vnet = this->stream->current_queue_id;
+    RecvPacketEventHandlerData* ehd = new RecvPacketEventHandlerData(
+        stream, stream->owner->id, EventType::PacketReceived,
+        stream->current_queue_id, stream->stream_id);
+    pending_recvs[ehd] = slot;
+    stream->owner->front_end_sim_recv(
+        0, Sys::dummy_data, get_sub_chunk_size(sub_chunk), UINT8, peer,
+        stream->stream_id, &rcv_req, Sys::FrontEndSendRecvType::COLLECTIVE,
+        &Sys::handleEvent, ehd);
+}
+
+void PipelinedTreeAllReduce::send(int peer, int sub_chunk) {
+    sim_request snd_req;
+    snd_req.srcRank = stream->owner->id;
+    snd_req.dstRank = peer;
+    snd_req.tag = stream->stream_id;
+    snd_req.reqType = UINT8;
+    snd_req.vnet = this->stream->current_queue_id;
+    stream->owner->front_end_sim_send(
+        0, Sys::dummy_data, get_sub_chunk_size(sub_chunk), UINT8, peer,
+        stream->stream_id, &snd_req, Sys::FrontEndSendRecvType::COLLECTIVE,
+        &Sys::handleEvent, nullptr);
+}
+
+void PipelinedTreeAllReduce::enqueue(Task task, int sub_chunk) {
+    tasks.push_back({task, sub_chunk});
+    if (!busy) {
+        start_next_task();
+    }
+}
+
+void PipelinedTreeAllReduce::start_next_task() {
+    busy = true;
+    std::pair<Task, int> task = tasks.front();
+    uint64_t size = get_sub_chunk_size(task.second);
+    if (task.first == Task::BroadcastDown) {
+        (new PacketBundle(stream->owner, stream, false, false, size,
+                          transmition))
+            ->send_to_NPU();
+    } else if (children.empty()) {
+        // a leaf only moves its own data to the network interface
+        (new PacketBundle(stream->owner, stream, false, false, size,
+                          transmition))
+            ->send_to_MA();
+    } else {
+        // reduces the sub-chunks of all children into the local one
+        (new PacketBundle(stream->owner, stream, true, false,
+                          size * children.size(), transmition))
+            ->send_to_NPU();
+    }
+}
+
+void PipelinedTreeAllReduce::finish_task() {
+    std::pair<Task, int> task = tasks.front();
+    tasks.pop_front();
+    busy = false;
+    if (task.first == Task::ReduceUp && parent >= 0) {
+        send(parent, task.second);
+    } else {
+        // the root turns the reduced sub-chunk around right away
+        for (int child : children) {
+            send(child, task.second);
+        }
+        finished++;
+    }
+}
+
+void PipelinedTreeAllReduce::run(EventType event, CallData* data) {
+    if (event == EventType::StreamInit) {
+        for (int slot = 0; slot < (int)children.size(); slot++) {
+            post_recv(slot);
+        }
+        if (parent >= 0) {
+            post_recv(-1);
+        }
+        if (children.empty()) {
+            for (; reduced < sub_chunks; reduced++) {
+                enqueue(Task::ReduceUp, reduced);
+            }
+        }
+
+    } else if (event == EventType::PacketReceived) {
+        RecvPacketEventHandlerData* ehd = (RecvPacketEventHandlerData*)data;
+        auto it = pending_recvs.find(ehd);
+        if (it == pending_recvs.end()) {
+            Sys::sys_panic("pipelined tree received an unexpected message");
+        }
+        int slot = it->second;
+        pending_recvs.erase(it);
+        if (slot < 0) {
+            enqueue(Task::BroadcastDown, received_from_parent++);
+            if (received_from_parent < sub_chunks) {
+                post_recv(slot);
+            }
+            return;
+        }
+        if (++received_from_child[slot] < sub_chunks) {
+            post_recv(slot);
+        }
+        // sub-chunk k can be reduced once every child delivered it
+        while (reduced < sub_chunks) {
+            for (int received : received_from_child) {
+                if (received <= reduced) {
+                    return;
+                }
+            }
+            enqueue(Task::ReduceUp, reduced++);
+        }
+
+    } else if (event == EventType::General) {
+        finish_task();
+        if (finished == sub_chunks) {
+            exit();
+            return;
+        }
+        if (!tasks.empty()) {
+            start_next_task();
+        }
+    }
+}
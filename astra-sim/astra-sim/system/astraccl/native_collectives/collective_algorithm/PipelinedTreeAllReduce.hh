@@ -0,0 +1,66 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#ifndef __PIPELINED_TREE_ALL_REDUCE_HH__
+#define __PIPELINED_TREE_ALL_REDUCE_HH__
+
+#include <deque>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "astra-sim/system/MemBus.hh"
+#include "astra-sim/system/RecvPacketEventHandlerData.hh"
+#include "astra-sim/system/astraccl/Algorithm.hh"
+#include "astra-sim/system/astraccl/native_collectives/logical_topology/RingTopology.hh"
+
+namespace AstraSim {
+
+/*
+ * PipelinedTreeAllReduce runs an all-reduce over a binary tree laid over the
+ * ring order, rooted at the first node of the ring. The data is split into
+ * sub-chunks: a node reduces sub-chunk k of its children and sends it up
+ * while sub-chunk k - 1 already travels down, so the reduce and the broadcast
+ * overlap like in NCCL's tree all-reduce.
+ */
+class PipelinedTreeAllReduce : public Algorithm {
+  public:
+    PipelinedTreeAllReduce(int id,
+                           RingTopology* ring_topology,
+                           uint64_t data_size,
+                           int sub_chunks);
+    void run(EventType event, CallData* data);
+
+  private:
+    enum class Task { ReduceUp = 0, BroadcastDown };
+
+    uint64_t get_sub_chunk_size(int sub_chunk);
+    // slot is the child index, or -1 for the parent
+    void post_recv(int slot);
+    void send(int peer, int sub_chunk);
+    // the local memory transfers of the sub-chunks are serialized, so each
+    // General event finishes the task at the front of the queue
+    void enqueue(Task task, int sub_chunk);
+    void start_next_task();
+    void finish_task();
+
+    RingTopology* ring_topology;
+    int sub_chunks;
+    int parent;
+    std::vector<int> children;
+    MemBus::Transmition transmition;
+
+    std::map<RecvPacketEventHandlerData*, int> pending_recvs;
+    std::vector<int> received_from_child;
+    int received_from_parent;
+    int reduced;
+    int finished;
+    std::deque<std::pair<Task, int>> tasks;
+    bool busy;
+};
+
+}  // namespace AstraSim
+
+#endif /* __PIPELINED_TREE_ALL_REDUCE_HH__ */
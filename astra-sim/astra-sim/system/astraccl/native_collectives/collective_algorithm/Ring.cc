@@ -34,7 +34,9 @@ Ring::Ring(ComType type,
     this->non_zero_latency_packets = 0;
     this->toggle = false;
     this->name = Name::Ring;
-    this->m_bidirectional = true;  // place to change bidirectional
+    // only halves the all-reduce messages, the traffic still flows in one
+    // direction; bidirectionalRing injects on both link directions
+    this->m_bidirectional = true;
     if (ring_topology->get_dimension() == RingTopology::Dimension::Local) {
         transmition = MemBus::Transmition::Fast;
     } else {
@@ -68,32 +70,65 @@ Ring::Ring(ComType type,
     }
     remained_packets_per_message = 1;
     remained_packets_per_max_count = 1;
+    this->final_data_size = get_final_data_size(type, data_size, nodes_in_ring);
     switch (type) {
     case ComType::All_Reduce:
         if (m_bidirectional) {
-            this->final_data_size = data_size / 2;
             this->msg_size = (data_size / nodes_in_ring) / 2;
         } else {
-            this->final_data_size = data_size;
             this->msg_size = data_size / nodes_in_ring;
         }
         break;
     case ComType::All_Gather:
-        this->final_data_size = data_size * nodes_in_ring;
         this->msg_size = data_size;
         break;
     case ComType::Reduce_Scatter:
-        this->final_data_size = data_size / nodes_in_ring;
         this->msg_size = data_size / nodes_in_ring;
         break;
     case ComType::All_to_All:
-        this->final_data_size = data_size;
         this->msg_size = data_size / nodes_in_ring;
         break;
     default:;
     }
 }
 
+uint64_t Ring::get_final_data_size(ComType type,
+                                   uint64_t data_size,
+                                   int nodes) {
+    switch (type) {
+    case ComType::All_Reduce:
+        // the all-reduce messages are halved, see m_bidirectional
+        return data_size / 2;
+    case ComType::All_Gather:
+        return data_size * nodes;
+    case ComType::Reduce_Scatter:
+        return data_size / nodes;
+    default:
+        return data_size;
+    }
+}
+
+bool Ring::get_closed_form_duration(Sys* sys, Tick& duration) {
+    // the data first moves to the network interface, then each step sends a
+    // message to the receiver and moves the received one back to the NPU
+    if (!sys->get_closed_form_bus_delay(transmition, duration)) {
+        return false;
+    }
+    int steps = (stream_count + parallel_reduce - 1) / parallel_reduce;
+    for (int step = 0; step < steps; step++) {
+        bool reduce = comType == ComType::Reduce_Scatter ||
+                      (comType == ComType::All_Reduce &&
+                       step < nodes_in_ring - 1);
+        Tick step_time = 0;
+        if (!sys->get_closed_form_step_time(curr_receiver, msg_size, reduce,
+                                            transmition, step_time)) {
+            return false;
+        }
+        duration += step_time;
+    }
+    return true;
+}
+
 int Ring::get_non_zero_latency_packets() {
     return (nodes_in_ring - 1) * parallel_reduce * 1;
 }
@@ -0,0 +1,122 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/RootedCollective.hh"
+
+#include "astra-sim/system/PacketBundle.hh"
+#include "astra-sim/system/RecvPacketEventHandlerData.hh"
+
+using namespace AstraSim;
+
+RootedCollective::RootedCollective(ComType type,
+                                   int id,
+                                   RingTopology* ring_topology,
+                                   uint64_t data_size,
+                                   int root)
+    : Algorithm() {
+    this->comType = type;
+    this->id = id;
+    this->logical_topo = ring_topology;
+    this->ring_topology = ring_topology;
+    this->data_size = data_size;
+    this->nodes_in_ring = ring_topology->get_nodes_in_ring();
+    this->root_index = ring_topology->get_coordinate(root);
+    this->state = State::Begin;
+    this->pending_messages = 0;
+    if (ring_topology->get_dimension() == RingTopology::Dimension::Local) {
+        transmition = MemBus::Transmition::Fast;
+    } else {
+        transmition = MemBus::Transmition::Usual;
+    }
+    this->final_data_size = get_final_data_size(type, data_size, nodes_in_ring);
+}
+
+uint64_t RootedCollective::get_final_data_size(ComType type,
+                                               uint64_t data_size,
+                                               int nodes) {
+    if (type == ComType::Gather) {
+        return data_size * nodes;
+    }
+    return data_size;
+}
+
+int RootedCollective::get_distance(RingTopology::Direction direction) {
+    int index = ring_topology->get_index_in_ring();
+    if (direction == RingTopology::Direction::Clockwise) {
+        return (index - root_index + nodes_in_ring) % nodes_in_ring;
+    }
+    return (root_index - index + nodes_in_ring) % nodes_in_ring;
+}
+
+int RootedCollective::get_peer(int distance,
+                               RingTopology::Direction direction) {
+    if (direction == RingTopology::Direction::Clockwise) {
+        return ring_topology->get_id((root_index + distance) % nodes_in_ring);
+    }
+    return ring_topology->get_id((root_index - distance + nodes_in_ring) %
+                                 nodes_in_ring);
+}
+
+void RootedCollective::run(EventType event, CallData* data) {
+    if (state == State::Begin && event == EventType::StreamInit) {
+        state = State::WaitingForData;
+        pending_messages = recv_from.size();
+        for (auto& peer : recv_from) {
+            sim_request rcv_req;
+            rcv_req.vnet = this->stream->current_queue_id;
+            RecvPacketEventHandlerData* ehd = new RecvPacketEventHandlerData(
+                stream, stream->owner->id, EventType::PacketReceived,
+                stream->current_queue_id, stream->stream_id);
+            ehd->message_size = peer.second;
+            stream->owner->front_end_sim_recv(
+                0, Sys::dummy_data, peer.second, UINT8, peer.first,
+                stream->stream_id, &rcv_req,
+                Sys::FrontEndSendRecvType::COLLECTIVE, &Sys::handleEvent, ehd);
+        }
+        if (pending_messages == 0) {
+            prepare_send();
+        }
+
+    } else if (state == State::WaitingForData &&
+               event == EventType::PacketReceived) {
+        // a reduce also has to reduce the data into the local buffer, a
+        // gather message holds the data of all the nodes further down
+        RecvPacketEventHandlerData* message = (RecvPacketEventHandlerData*)data;
+        (new PacketBundle(stream->owner, stream, comType == ComType::Reduce,
+                          false, message->message_size, transmition))
+            ->send_to_NPU();
+
+    } else if (state == State::WaitingForData &&
+               event == EventType::General) {
+        pending_messages--;
+        if (pending_messages == 0) {
+            prepare_send();
+        }
+
+    } else if (state == State::SendingData && event == EventType::General) {
+        for (auto& peer : send_to) {
+            sim_request snd_req;
+            snd_req.srcRank = stream->owner->id;
+            snd_req.dstRank = peer.first;
+            snd_req.tag = stream->stream_id;
+            snd_req.reqType = UINT8;
+            snd_req.vnet = this->stream->current_queue_id;
+            stream->owner->front_end_sim_send(
+                0, Sys::dummy_data, peer.second, UINT8, peer.first,
+                stream->stream_id, &snd_req,
+                Sys::FrontEndSendRecvType::COLLECTIVE, &Sys::handleEvent,
+                nullptr);
+        }
+        state = State::End;
+        exit();
+    }
+}
+
+void RootedCollective::prepare_send() {
+    state = State::SendingData;
+    (new PacketBundle(stream->owner, stream, false, false, data_size,
+                      transmition))
+        ->send_to_MA();
+}
@@ -0,0 +1,66 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#ifndef __ROOTED_COLLECTIVE_HH__
+#define __ROOTED_COLLECTIVE_HH__
+
+#include <utility>
+#include <vector>
+
+#include "astra-sim/system/MemBus.hh"
+#include "astra-sim/system/astraccl/Algorithm.hh"
+#include "astra-sim/system/astraccl/native_collectives/logical_topology/RingTopology.hh"
+
+namespace AstraSim {
+
+/*
+ * RootedCollective runs a broadcast, reduce or gather within one dimension.
+ * Every node first waits for the messages of the peers in recv_from, reduces
+ * them into its own data in case of a reduce, and then forwards the result to
+ * the peers in send_to. The subclasses only decide on the peers and the
+ * message sizes.
+ */
+class RootedCollective : public Algorithm {
+  public:
+    enum class State { Begin = 0, WaitingForData, SendingData, End };
+
+    RootedCollective(ComType type,
+                     int id,
+                     RingTopology* ring_topology,
+                     uint64_t data_size,
+                     int root);
+    void run(EventType event, CallData* data);
+    // final data size of the collective, also used to plan the following
+    // phases before the algorithm is created
+    static uint64_t get_final_data_size(ComType type,
+                                        uint64_t data_size,
+                                        int nodes);
+
+  protected:
+    // distance of this node from the root when walking the ring
+    int get_distance(RingTopology::Direction direction);
+    // id of the node that is the given distance away from the root
+    int get_peer(int distance, RingTopology::Direction direction);
+
+    RingTopology* ring_topology;
+    int nodes_in_ring;
+    int root_index;
+    // (peer id, message size) pairs
+    std::vector<std::pair<int, uint64_t>> recv_from;
+    std::vector<std::pair<int, uint64_t>> send_to;
+
+  private:
+    // moves the data to the network interface, the messages are sent once
+    // it arrives
+    void prepare_send();
+
+    State state;
+    MemBus::Transmition transmition;
+    int pending_messages;
+};
+
+}  // namespace AstraSim
+
+#endif /* __ROOTED_COLLECTIVE_HH__ */
@@ -0,0 +1,52 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/RootedRing.hh"
+
+using namespace AstraSim;
+
+RootedRing::RootedRing(ComType type,
+                       int id,
+                       RingTopology* ring_topology,
+                       uint64_t data_size,
+                       RingTopology::Direction direction,
+                       int root)
+    : RootedCollective(type, id, ring_topology, data_size, root) {
+    this->name = Name::RootedRing;
+    int distance = get_distance(direction);
+    int last = nodes_in_ring - 1;
+    switch (type) {
+    case ComType::Broadcast:
+        if (distance > 0) {
+            recv_from.push_back({get_peer(distance - 1, direction), data_size});
+        }
+        if (distance < last) {
+            send_to.push_back({get_peer(distance + 1, direction), data_size});
+        }
+        break;
+    case ComType::Reduce:
+        if (distance < last) {
+            recv_from.push_back({get_peer(distance + 1, direction), data_size});
+        }
+        if (distance > 0) {
+            send_to.push_back({get_peer(distance - 1, direction), data_size});
+        }
+        break;
+    case ComType::Gather:
+        // every node adds its own data to what it got from further down
+        if (distance < last) {
+            recv_from.push_back({get_peer(distance + 1, direction),
+                                 data_size * (last - distance)});
+        }
+        if (distance > 0) {
+            send_to.push_back({get_peer(distance - 1, direction),
+                               data_size * (nodes_in_ring - distance)});
+        }
+        break;
+    default:
+        Sys::sys_panic("rooted ring only implements broadcast, reduce and "
+                       "gather");
+    }
+}
@@ -0,0 +1,31 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#ifndef __ROOTED_RING_HH__
+#define __ROOTED_RING_HH__
+
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/RootedCollective.hh"
+
+namespace AstraSim {
+
+/*
+ * RootedRing passes the data along a chain that starts (broadcast) or ends
+ * (reduce, gather) at the root, following the ring in the given direction.
+ * Consecutive chunks of the collective travel the chain in a pipelined
+ * fashion.
+ */
+class RootedRing : public RootedCollective {
+  public:
+    RootedRing(ComType type,
+               int id,
+               RingTopology* ring_topology,
+               uint64_t data_size,
+               RingTopology::Direction direction,
+               int root);
+};
+
+}  // namespace AstraSim
+
+#endif /* __ROOTED_RING_HH__ */
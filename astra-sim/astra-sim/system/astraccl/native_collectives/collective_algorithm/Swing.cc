@@ -0,0 +1,62 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/Swing.hh"
+
+using namespace AstraSim;
+
+Swing::Swing(ComType type,
+             int id,
+             RingTopology* ring_topology,
+             uint64_t data_size)
+    : BidirectionalCollective(type, id, ring_topology, data_size) {
+    this->name = Name::Swing;
+    if ((nodes_in_ring & (nodes_in_ring - 1)) != 0) {
+        Sys::sys_panic("swing needs a power of two number of nodes, but the "
+                       "dimension has " +
+                       std::to_string(nodes_in_ring));
+    }
+    int log_nodes = 0;
+    while ((1 << log_nodes) < nodes_in_ring) {
+        log_nodes++;
+    }
+    uint64_t lane_size = get_lane_size();
+    for (int lane = 0; lane < 2; lane++) {
+        bool mirrored = lane == 1;
+        // reduce-scatter halves the exchanged data at every step
+        if (type != ComType::All_Gather) {
+            for (int step = 0; step < log_nodes; step++) {
+                int peer = get_peer(step, mirrored);
+                lanes[lane].push_back(
+                    {peer, peer, lane_size >> (step + 1), true});
+            }
+        }
+        // all-gather replays the steps in reverse and doubles the data
+        if (type != ComType::Reduce_Scatter) {
+            for (int step = log_nodes - 1; step >= 0; step--) {
+                int peer = get_peer(step, mirrored);
+                lanes[lane].push_back(
+                    {peer, peer, lane_size >> (step + 1), false});
+            }
+        }
+    }
+}
+
+int Swing::get_peer(int step, bool mirrored) {
+    // rho(step) = 1, -1, 3, -5, 11, ...
+    long long rho = 0;
+    long long power = 1;
+    for (int i = 0; i <= step; i++) {
+        rho += power;
+        power *= -2;
+    }
+    int index = ring_topology->get_index_in_ring();
+    if ((index % 2 == 0) == mirrored) {
+        rho = -rho;
+    }
+    long long peer = ((index + rho) % nodes_in_ring + nodes_in_ring) %
+                     nodes_in_ring;
+    return ring_topology->get_id(peer);
+}
@@ -0,0 +1,35 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#ifndef __SWING_HH__
+#define __SWING_HH__
+
+#include "astra-sim/system/astraccl/native_collectives/collective_algorithm/BidirectionalCollective.hh"
+
+namespace AstraSim {
+
+/*
+ * Swing runs the recursive halving (reduce-scatter) and doubling (all-gather)
+ * steps of the Swing algorithm (De Sensi et al., NSDI'24). At step s an even
+ * node exchanges data with the node rho(s) = (1 - (-2)^(s + 1)) / 3 positions
+ * ahead in the ring and an odd node with the one rho(s) positions behind, so
+ * the peers stay close on a torus instead of being 2^s hops away. The second
+ * half of the data runs the mirrored pattern, which uses the other link
+ * direction. The number of nodes must be a power of two.
+ */
+class Swing : public BidirectionalCollective {
+  public:
+    Swing(ComType type,
+          int id,
+          RingTopology* ring_topology,
+          uint64_t data_size);
+
+  private:
+    int get_peer(int step, bool mirrored);
+};
+
+}  // namespace AstraSim
+
+#endif /* __SWING_HH__ */
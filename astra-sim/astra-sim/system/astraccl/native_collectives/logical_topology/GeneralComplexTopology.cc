@@ -28,6 +28,12 @@ GeneralComplexTopology::GeneralComplexTopology(
         if (collective_impl[dim]->type == CollectiveImplType::Ring ||
             collective_impl[dim]->type == CollectiveImplType::Direct ||
             collective_impl[dim]->type == CollectiveImplType::HalvingDoubling ||
+            collective_impl[dim]->type == CollectiveImplType::BinomialTree ||
+            collective_impl[dim]->type == CollectiveImplType::PipelinedTree ||
+            collective_impl[dim]->type ==
+                CollectiveImplType::BidirectionalRing ||
+            collective_impl[dim]->type == CollectiveImplType::Swing ||
+            collective_impl[dim]->type == CollectiveImplType::InNetwork ||
             // While executing a collective according a Chakra ET representation
             // does not need information on the logical topology, The system
             // layer's logic of defining and invoking "collective phase" objects
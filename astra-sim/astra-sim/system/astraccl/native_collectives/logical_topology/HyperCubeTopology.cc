@@ -26,6 +26,7 @@ HyperCubeTopology::HyperCubeTopology(Dimension dimension,
     this->total_nodes_in_hypercube = NPUs.size();
     this->dimension = dimension;
     this->offset = -1;
+    this->first_id = -1;
     this->index_in_hypercube = -1;
     for (int i = 0; i < total_nodes_in_hypercube; i++) {
         id_to_index[NPUs[i]] = i;
@@ -36,11 +37,11 @@ HyperCubeTopology::HyperCubeTopology(Dimension dimension,
     }
 
     LoggerFactory::get_logger("system::topology::HyperCubeTopology")
-        ->info("custom hypercube, id: {}, dimension: {} total nodes in "
-               "hypercube: {} "
-               "index in hypercube: {} total nodes in hypercube {}",
-               id, name, total_nodes_in_hypercube, index_in_hypercube,
-               total_nodes_in_hypercube);
+        ->debug("custom hypercube, id: {}, dimension: {} total nodes in "
+                "hypercube: {} index in hypercube: {} total nodes in "
+                "hypercube {}",
+                id, name, total_nodes_in_hypercube, index_in_hypercube,
+                total_nodes_in_hypercube);
 
     assert(index_in_hypercube >= 0);
 }
@@ -59,9 +60,8 @@ HyperCubeTopology::HyperCubeTopology(Dimension dimension,
     if (id == 0) {
         LoggerFactory::get_logger("system::topology::HyperCubeTopology")
             ->info("hypercube of node 0, id: {} dimension: {} total nodes in "
-                   "hypercube: "
-                   "{} index in hypercube: {} offset: {} total nodes in "
-                   "hypercube: {}",
+                   "hypercube: {} index in hypercube: {} offset: {} total "
+                   "nodes in hypercube: {}",
                    id, name, total_nodes_in_hypercube, index_in_hypercube,
                    offset, total_nodes_in_hypercube);
     }
@@ -70,97 +70,66 @@ HyperCubeTopology::HyperCubeTopology(Dimension dimension,
     this->index_in_hypercube = index_in_hypercube;
     this->dimension = dimension;
     this->offset = offset;
-
-    id_to_index[id] = index_in_hypercube;
-    index_to_id[index_in_hypercube] = id;
-    int tmp = id;
-    for (int i = 0; i < total_nodes_in_hypercube - 1; i++) {
-        tmp = get_receiver_homogeneous(
-            tmp, HyperCubeTopology::Direction::Clockwise, offset);
+    // the members of a homogeneous hypercube are offset apart, so their ids and
+    // indices are computed instead of being stored
+    this->first_id = id - index_in_hypercube * offset;
+    if (first_id < 0) {
+        LoggerFactory::get_logger("system::topology::HyperCubeTopology")
+            ->critical("at id: {} dimension: {} offset: {}, "
+                       "index_in_hypercube {} first id {}",
+                       id, name, offset, index_in_hypercube, first_id);
     }
+    assert(first_id >= 0);
 }
 
-int HyperCubeTopology::get_receiver_homogeneous(int node_id,
-                                                Direction direction,
-                                                int offset) {
+int HyperCubeTopology::get_index(int node_id) {
+    if (offset > 0) {
+        assert(node_id >= first_id && (node_id - first_id) % offset == 0 &&
+               (node_id - first_id) / offset < total_nodes_in_hypercube);
+        return (node_id - first_id) / offset;
+    }
     assert(id_to_index.find(node_id) != id_to_index.end());
-    int index = id_to_index[node_id];
-    if (direction == HyperCubeTopology::Direction::Clockwise) {
-        int receiver = node_id + offset;
-        if (index == total_nodes_in_hypercube - 1) {
-            receiver -= (total_nodes_in_hypercube * offset);
-            index = 0;
-        } else {
-            index++;
-        }
-        if (receiver < 0) {
-            LoggerFactory::get_logger("system::topology::HyperCubeTopology")
-                ->critical(
-                    "at dim: {} at id: {} dimension: {} index: {}, node "
-                    "id: {}, offset: {}, index_in_hypercube {} receiver {}",
-                    name, id, name, index, node_id, offset, index_in_hypercube,
-                    receiver);
-        }
-        assert(receiver >= 0);
-        id_to_index[receiver] = index;
-        index_to_id[index] = receiver;
-        return receiver;
-    } else {
-        int receiver = node_id - offset;
-        if (index == 0) {
-            receiver += (total_nodes_in_hypercube * offset);
-            index = total_nodes_in_hypercube - 1;
-        } else {
-            index--;
-        }
-        if (receiver < 0) {
-            LoggerFactory::get_logger("system::topology::HyperCubeTopology")
-                ->critical(
-                    "at dim: {} at id: {} dimension: {} index: {}, node "
-                    "id: {}, offset: {}, index_in_hypercube {} receiver {}",
-                    name, id, name, index, node_id, offset, index_in_hypercube,
-                    receiver);
-        }
-        assert(receiver >= 0);
-        id_to_index[receiver] = index;
-        index_to_id[index] = receiver;
-        return receiver;
+    return id_to_index[node_id];
+}
+
+int HyperCubeTopology::get_id(int index) {
+    if (offset > 0) {
+        return first_id + index * offset;
     }
+    return index_to_id[index];
 }
 
 int HyperCubeTopology::get_receiver(int node_id, Direction direction) {
-    assert(id_to_index.find(node_id) != id_to_index.end());
-    int index = id_to_index[node_id];
+    int index = get_index(node_id);
     if (direction == HyperCubeTopology::Direction::Clockwise) {
         index++;
         if (index == total_nodes_in_hypercube) {
             index = 0;
         }
-        return index_to_id[index];
+        return get_id(index);
     } else {
         index--;
         if (index < 0) {
             index = total_nodes_in_hypercube - 1;
         }
-        return index_to_id[index];
+        return get_id(index);
     }
 }
 
 int HyperCubeTopology::get_sender(int node_id, Direction direction) {
-    assert(id_to_index.find(node_id) != id_to_index.end());
-    int index = id_to_index[node_id];
+    int index = get_index(node_id);
     if (direction == HyperCubeTopology::Direction::Anticlockwise) {
         index++;
         if (index == total_nodes_in_hypercube) {
             index = 0;
         }
-        return index_to_id[index];
+        return get_id(index);
     } else {
         index--;
         if (index < 0) {
             index = total_nodes_in_hypercube - 1;
         }
-        return index_to_id[index];
+        return get_id(index);
     }
 }
 
@@ -182,14 +151,5 @@ int HyperCubeTopology::get_nodes_in_hypercube() {
 
 bool HyperCubeTopology::is_enabled() {
     assert(offset > 0);
-    int tmp_index = index_in_hypercube;
-    int tmp_id = id;
-    while (tmp_index > 0) {
-        tmp_index--;
-        tmp_id -= offset;
-    }
-    if (tmp_id == 0) {
-        return true;
-    }
-    return false;
+    return first_id == 0;
 }
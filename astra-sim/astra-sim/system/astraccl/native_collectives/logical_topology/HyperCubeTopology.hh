@@ -34,6 +34,7 @@ class HyperCubeTopology : public BasicLogicalTopology {
     int get_index_in_hypercube();
 
   private:
+    // only filled for custom (non-homogeneous) hypercubes
     std::unordered_map<int, int> id_to_index;
     std::unordered_map<int, int> index_to_id;
 
@@ -43,10 +44,12 @@ class HyperCubeTopology : public BasicLogicalTopology {
     int total_nodes_in_hypercube;
     int index_in_hypercube;
     Dimension dimension;
+    // id of the node at index 0 of a homogeneous hypercube, -1 for a custom
+    // hypercube
+    int first_id;
 
-    virtual int get_receiver_homogeneous(int node_id,
-                                         Direction direction,
-                                         int offset);
+    int get_index(int node_id);
+    int get_id(int index);
 };
 
 }  // namespace AstraSim
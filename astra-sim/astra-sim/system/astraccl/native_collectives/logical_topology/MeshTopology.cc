@@ -24,6 +24,7 @@ MeshTopology::MeshTopology(Dimension dimension, int id, std::vector<int> NPUs)
     this->total_nodes_in_mesh = NPUs.size();
     this->dimension = dimension;
     this->offset = -1;
+    this->first_id = -1;
     this->index_in_mesh = -1;
     for (int i = 0; i < total_nodes_in_mesh; i++) {
         id_to_index[NPUs[i]] = i;
@@ -34,10 +35,10 @@ MeshTopology::MeshTopology(Dimension dimension, int id, std::vector<int> NPUs)
     }
 
     LoggerFactory::get_logger("system::topology::MeshTopology")
-        ->info("custom mesh, id: {}, dimension: {} total nodes in mesh: {} "
-               "index in mesh: {} total nodes in mesh {}",
-               id, name, total_nodes_in_mesh, index_in_mesh,
-               total_nodes_in_mesh);
+        ->debug("custom mesh, id: {}, dimension: {} total nodes in mesh: {} "
+                "index in mesh: {} total nodes in mesh {}",
+                id, name, total_nodes_in_mesh, index_in_mesh,
+                total_nodes_in_mesh);
 
     assert(index_in_mesh >= 0);
 }
@@ -65,95 +66,66 @@ MeshTopology::MeshTopology(Dimension dimension,
     this->index_in_mesh = index_in_mesh;
     this->dimension = dimension;
     this->offset = offset;
-
-    id_to_index[id] = index_in_mesh;
-    index_to_id[index_in_mesh] = id;
-    int tmp = id;
-    for (int i = 0; i < total_nodes_in_mesh - 1; i++) {
-        tmp = get_receiver_homogeneous(tmp, MeshTopology::Direction::Clockwise,
-                                       offset);
+    // the members of a homogeneous mesh are offset apart, so their ids and
+    // indices are computed instead of being stored
+    this->first_id = id - index_in_mesh * offset;
+    if (first_id < 0) {
+        LoggerFactory::get_logger("system::topology::MeshTopology")
+            ->critical("at id: {} dimension: {} offset: {}, index_in_mesh {} "
+                       "first id {}",
+                       id, name, offset, index_in_mesh, first_id);
     }
+    assert(first_id >= 0);
 }
 
-int MeshTopology::get_receiver_homogeneous(int node_id,
-                                           Direction direction,
-                                           int offset) {
+int MeshTopology::get_index(int node_id) {
+    if (offset > 0) {
+        assert(node_id >= first_id && (node_id - first_id) % offset == 0 &&
+               (node_id - first_id) / offset < total_nodes_in_mesh);
+        return (node_id - first_id) / offset;
+    }
     assert(id_to_index.find(node_id) != id_to_index.end());
-    int index = id_to_index[node_id];
-    if (direction == MeshTopology::Direction::Clockwise) {
-        int receiver = node_id + offset;
-        if (index == total_nodes_in_mesh - 1) {
-            receiver -= (total_nodes_in_mesh * offset);
-            index = 0;
-        } else {
-            index++;
-        }
-        if (receiver < 0) {
-            LoggerFactory::get_logger("system::topology::MeshTopology")
-                ->critical("at dim: {} at id: {} dimension: {} index: {}, node "
-                           "id: {}, offset: {}, index_in_mesh {} receiver {}",
-                           name, id, name, index, node_id, offset,
-                           index_in_mesh, receiver);
-        }
-        assert(receiver >= 0);
-        id_to_index[receiver] = index;
-        index_to_id[index] = receiver;
-        return receiver;
-    } else {
-        int receiver = node_id - offset;
-        if (index == 0) {
-            receiver += (total_nodes_in_mesh * offset);
-            index = total_nodes_in_mesh - 1;
-        } else {
-            index--;
-        }
-        if (receiver < 0) {
-            LoggerFactory::get_logger("system::topology::MeshTopology")
-                ->critical("at dim: {} at id: {} dimension: {} index: {}, node "
-                           "id: {}, offset: {}, index_in_mesh {} receiver {}",
-                           name, id, name, index, node_id, offset,
-                           index_in_mesh, receiver);
-        }
-        assert(receiver >= 0);
-        id_to_index[receiver] = index;
-        index_to_id[index] = receiver;
-        return receiver;
+    return id_to_index[node_id];
+}
+
+int MeshTopology::get_id(int index) {
+    if (offset > 0) {
+        return first_id + index * offset;
     }
+    return index_to_id[index];
 }
 
 int MeshTopology::get_receiver(int node_id, Direction direction) {
-    assert(id_to_index.find(node_id) != id_to_index.end());
-    int index = id_to_index[node_id];
+    int index = get_index(node_id);
     if (direction == MeshTopology::Direction::Clockwise) {
         index++;
         if (index == total_nodes_in_mesh) {
             index = 0;
         }
-        return index_to_id[index];
+        return get_id(index);
     } else {
         index--;
         if (index < 0) {
             index = total_nodes_in_mesh - 1;
         }
-        return index_to_id[index];
+        return get_id(index);
     }
 }
 
 int MeshTopology::get_sender(int node_id, Direction direction) {
-    assert(id_to_index.find(node_id) != id_to_index.end());
-    int index = id_to_index[node_id];
+    int index = get_index(node_id);
     if (direction == MeshTopology::Direction::Anticlockwise) {
         index++;
         if (index == total_nodes_in_mesh) {
             index = 0;
         }
-        return index_to_id[index];
+        return get_id(index);
     } else {
         index--;
         if (index < 0) {
             index = total_nodes_in_mesh - 1;
         }
-        return index_to_id[index];
+        return get_id(index);
     }
 }
 
@@ -175,14 +147,5 @@ int MeshTopology::get_nodes_in_mesh() {
 
 bool MeshTopology::is_enabled() {
     assert(offset > 0);
-    int tmp_index = index_in_mesh;
-    int tmp_id = id;
-    while (tmp_index > 0) {
-        tmp_index--;
-        tmp_id -= offset;
-    }
-    if (tmp_id == 0) {
-        return true;
-    }
-    return false;
+    return first_id == 0;
 }
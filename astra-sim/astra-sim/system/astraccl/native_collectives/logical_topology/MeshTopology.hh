@@ -34,6 +34,7 @@ class MeshTopology : public BasicLogicalTopology {
     int get_index_in_mesh();
 
   private:
+    // only filled for custom (non-homogeneous) meshes
     std::unordered_map<int, int> id_to_index;
     std::unordered_map<int, int> index_to_id;
 
@@ -43,10 +44,11 @@ class MeshTopology : public BasicLogicalTopology {
     int total_nodes_in_mesh;
     int index_in_mesh;
     Dimension dimension;
+    // id of the node at index 0 of a homogeneous mesh, -1 for a custom mesh
+    int first_id;
 
-    virtual int get_receiver_homogeneous(int node_id,
-                                         Direction direction,
-                                         int offset);
+    int get_index(int node_id);
+    int get_id(int index);
 };
 
 }  // namespace AstraSim
@@ -24,6 +24,7 @@ RingTopology::RingTopology(Dimension dimension, int id, std::vector<int> NPUs)
     this->total_nodes_in_ring = NPUs.size();
     this->dimension = dimension;
     this->offset = -1;
+    this->first_id = -1;
     this->index_in_ring = -1;
     for (int i = 0; i < total_nodes_in_ring; i++) {
         id_to_index[NPUs[i]] = i;
@@ -34,10 +35,10 @@ RingTopology::RingTopology(Dimension dimension, int id, std::vector<int> NPUs)
     }
 
     LoggerFactory::get_logger("system::topology::RingTopology")
-        ->info("custom ring, id: {}, dimension: {} total nodes in ring: {} "
-               "index in ring: {} total nodes in ring {}",
-               id, name, total_nodes_in_ring, index_in_ring,
-               total_nodes_in_ring);
+        ->debug("custom ring, id: {}, dimension: {} total nodes in ring: {} "
+                "index in ring: {} total nodes in ring {}",
+                id, name, total_nodes_in_ring, index_in_ring,
+                total_nodes_in_ring);
 
     assert(index_in_ring >= 0);
 }
@@ -65,95 +66,73 @@ RingTopology::RingTopology(Dimension dimension,
     this->index_in_ring = index_in_ring;
     this->dimension = dimension;
     this->offset = offset;
-
-    id_to_index[id] = index_in_ring;
-    index_to_id[index_in_ring] = id;
-    int tmp = id;
-    for (int i = 0; i < total_nodes_in_ring - 1; i++) {
-        tmp = get_receiver_homogeneous(tmp, RingTopology::Direction::Clockwise,
-                                       offset);
+    // the members of a homogeneous ring are offset apart, so their ids and
+    // indices are computed instead of being stored
+    this->first_id = id - index_in_ring * offset;
+    if (first_id < 0) {
+        LoggerFactory::get_logger("system::topology::RingTopology")
+            ->critical("at id: {} dimension: {} offset: {}, index_in_ring {} "
+                       "first id {}",
+                       id, name, offset, index_in_ring, first_id);
     }
+    assert(first_id >= 0);
 }
 
-int RingTopology::get_receiver_homogeneous(int node_id,
-                                           Direction direction,
-                                           int offset) {
+int RingTopology::get_index(int node_id) {
+    if (offset > 0) {
+        assert(node_id >= first_id && (node_id - first_id) % offset == 0 &&
+               (node_id - first_id) / offset < total_nodes_in_ring);
+        return (node_id - first_id) / offset;
+    }
     assert(id_to_index.find(node_id) != id_to_index.end());
-    int index = id_to_index[node_id];
-    if (direction == RingTopology::Direction::Clockwise) {
-        int receiver = node_id + offset;
-        if (index == total_nodes_in_ring - 1) {
-            receiver -= (total_nodes_in_ring * offset);
-            index = 0;
-        } else {
-            index++;
-        }
-        if (receiver < 0) {
-            LoggerFactory::get_logger("system::topology::RingTopology")
-                ->critical("at dim: {} at id: {} dimension: {} index: {}, node "
-                           "id: {}, offset: {}, index_in_ring {} receiver {}",
-                           name, id, name, index, node_id, offset,
-                           index_in_ring, receiver);
-        }
-        assert(receiver >= 0);
-        id_to_index[receiver] = index;
-        index_to_id[index] = receiver;
-        return receiver;
-    } else {
-        int receiver = node_id - offset;
-        if (index == 0) {
-            receiver += (total_nodes_in_ring * offset);
-            index = total_nodes_in_ring - 1;
-        } else {
-            index--;
-        }
-        if (receiver < 0) {
-            LoggerFactory::get_logger("system::topology::RingTopology")
-                ->critical("at dim: {} at id: {} dimension: {} index: {}, node "
-                           "id: {}, offset: {}, index_in_ring {} receiver {}",
-                           name, id, name, index, node_id, offset,
-                           index_in_ring, receiver);
-        }
-        assert(receiver >= 0);
-        id_to_index[receiver] = index;
-        index_to_id[index] = receiver;
-        return receiver;
+    return id_to_index[node_id];
+}
+
+int RingTopology::get_id(int index) {
+    if (offset > 0) {
+        return first_id + index * offset;
+    }
+    return index_to_id[index];
+}
+
+int RingTopology::get_coordinate(int node_id) {
+    if (offset > 0) {
+        return (node_id / offset) % total_nodes_in_ring;
     }
+    return get_index(node_id);
 }
 
 int RingTopology::get_receiver(int node_id, Direction direction) {
-    assert(id_to_index.find(node_id) != id_to_index.end());
-    int index = id_to_index[node_id];
+    int index = get_index(node_id);
     if (direction == RingTopology::Direction::Clockwise) {
         index++;
         if (index == total_nodes_in_ring) {
             index = 0;
         }
-        return index_to_id[index];
+        return get_id(index);
     } else {
         index--;
         if (index < 0) {
             index = total_nodes_in_ring - 1;
         }
-        return index_to_id[index];
+        return get_id(index);
     }
 }
 
 int RingTopology::get_sender(int node_id, Direction direction) {
-    assert(id_to_index.find(node_id) != id_to_index.end());
-    int index = id_to_index[node_id];
+    int index = get_index(node_id);
     if (direction == RingTopology::Direction::Anticlockwise) {
         index++;
         if (index == total_nodes_in_ring) {
             index = 0;
         }
-        return index_to_id[index];
+        return get_id(index);
     } else {
         index--;
         if (index < 0) {
             index = total_nodes_in_ring - 1;
         }
-        return index_to_id[index];
+        return get_id(index);
     }
 }
 
@@ -175,14 +154,5 @@ int RingTopology::get_nodes_in_ring() {
 
 bool RingTopology::is_enabled() {
     assert(offset > 0);
-    int tmp_index = index_in_ring;
-    int tmp_id = id;
-    while (tmp_index > 0) {
-        tmp_index--;
-        tmp_id -= offset;
-    }
-    if (tmp_id == 0) {
-        return true;
-    }
-    return false;
+    return first_id == 0;
 }
@@ -32,8 +32,13 @@ class RingTopology : public BasicLogicalTopology {
     bool is_enabled();
     Dimension get_dimension();
     int get_index_in_ring();
+    // index of the ring member that shares the given node's coordinate in
+    // this dimension, the node itself does not have to be in the ring
+    int get_coordinate(int node_id);
+    int get_id(int index);
 
   private:
+    // only filled for custom (non-homogeneous) rings
     std::unordered_map<int, int> id_to_index;
     std::unordered_map<int, int> index_to_id;
 
@@ -43,10 +48,10 @@ class RingTopology : public BasicLogicalTopology {
     int total_nodes_in_ring;
     int index_in_ring;
     Dimension dimension;
+    // id of the node at index 0 of a homogeneous ring, -1 for a custom ring
+    int first_id;
 
-    virtual int get_receiver_homogeneous(int node_id,
-                                         Direction direction,
-                                         int offset);
+    int get_index(int node_id);
 };
 
 }  // namespace AstraSim
@@ -14,16 +14,13 @@ LICENSE file in the root directory of this source tree.
 
 using namespace AstraSim;
 
-std::map<long long, std::vector<int>> OfflineGreedy::chunk_schedule;
-std::map<long long, int> OfflineGreedy::schedule_consumer;
-std::map<long long, uint64_t> OfflineGreedy::global_chunk_size;
-
 DimElapsedTime::DimElapsedTime(int dim_num) {
     this->dim_num = dim_num;
     this->elapsed_time = 0;
 }
 OfflineGreedy::OfflineGreedy(Sys* sys) {
     this->sys = sys;
+    this->first_chunk_id = 0;
     if (sys->dim_to_break == -1) {
         this->dim_size = sys->physical_dims;
         this->dim_BW.resize(this->dim_size.size());
@@ -43,6 +40,13 @@ OfflineGreedy::OfflineGreedy(Sys* sys) {
             this->dim_elapsed_time.push_back(DimElapsedTime(i));
         }
     }
+    for (uint64_t i = 0; i < this->dim_BW.size(); i++) {
+        if (this->dim_BW[i] <= 0) {
+            Sys::sys_panic("offline greedy inter-dimension scheduling needs "
+                           "the bandwidth of every dimension, which the "
+                           "network backend does not provide");
+        }
+    }
     if (sys->id == 0) {
         auto logger = LoggerFactory::get_logger("themis");
         logger->info("Themis is configured with the following parameters:");
@@ -91,25 +95,20 @@ std::vector<int> OfflineGreedy::get_chunk_scheduling(
     std::vector<bool>& dimensions_involved,
     InterDimensionScheduling inter_dim_scheduling,
     ComType comm_type) {
-    if (chunk_schedule.find(chunk_id) != chunk_schedule.end()) {
-        schedule_consumer[chunk_id]++;
-        if (schedule_consumer[chunk_id] ==
-            static_cast<int64_t>(sys->all_sys.size())) {
-            std::vector<int> res = chunk_schedule[chunk_id];
-            remaining_data_size -= global_chunk_size[chunk_id];
-            chunk_schedule.erase(chunk_id);
-            schedule_consumer.erase(chunk_id);
-            global_chunk_size.erase(chunk_id);
-            return res;
-        }
-        remaining_data_size -= global_chunk_size[chunk_id];
-        return chunk_schedule[chunk_id];
+    OfflineGreedy* planner = sys->all_sys[0]->offline_greedy;
+    ChunkPlan* plan = planner->find_plan(chunk_id);
+    if (plan != nullptr) {
+        std::vector<int> res = plan->schedule;
+        remaining_data_size -= plan->chunk_size;
+        planner->consume_plan(plan);
+        return res;
     }
     if (sys->id != 0) {
-        return sys->all_sys[0]->offline_greedy->get_chunk_scheduling(
+        return planner->get_chunk_scheduling(
             chunk_id, remaining_data_size, recommended_chunk_size,
             dimensions_involved, inter_dim_scheduling, comm_type);
     } else {
+        uint64_t planned_chunk_size = 0;
         if (comm_type == ComType::All_Reduce) {
             comm_type = ComType::Reduce_Scatter;
         }
@@ -121,7 +120,7 @@ std::vector<int> OfflineGreedy::get_chunk_scheduling(
         uint64_t chunk_size = recommended_chunk_size;
         bool chunk_size_calculated = false;
         if (inter_dim_scheduling == InterDimensionScheduling::OfflineGreedy) {
-            global_chunk_size[chunk_id] =
+            planned_chunk_size =
                 std::min(remaining_data_size, chunk_size);
             remaining_data_size -= std::min(remaining_data_size, chunk_size);
         }
@@ -169,14 +168,13 @@ std::vector<int> OfflineGreedy::get_chunk_scheduling(
                 if (chunk_size < (recommended_chunk_size)) {
                     result.resize(dim_elapsed_time.size());
                     std::iota(std::begin(result), std::end(result), 0);
-                    global_chunk_size[chunk_id] =
+                    planned_chunk_size =
                         std::min(remaining_data_size, recommended_chunk_size);
                     chunk_size =
                         std::min(remaining_data_size, recommended_chunk_size);
                     remaining_data_size -=
                         std::min(remaining_data_size, recommended_chunk_size);
-                    chunk_schedule[chunk_id] = result;
-                    schedule_consumer[chunk_id] = 1;
+                    store_plan(chunk_id, result, planned_chunk_size);
                     std::vector<DimElapsedTime> myReordered;
                     myReordered.resize(dim_elapsed_time.size(),
                                        dim_elapsed_time[0]);
@@ -221,7 +219,7 @@ std::vector<int> OfflineGreedy::get_chunk_scheduling(
                     }
                     return result;
                 } else {
-                    global_chunk_size[chunk_id] =
+                    planned_chunk_size =
                         std::min(remaining_data_size, chunk_size);
                     remaining_data_size -=
                         std::min(remaining_data_size, chunk_size);
@@ -264,8 +262,7 @@ std::vector<int> OfflineGreedy::get_chunk_scheduling(
                 if (diff_size < (recommended_chunk_size / 16)) {
                     result.resize(dim_elapsed_time.size());
                     std::iota(std::begin(result), std::end(result), 0);
-                    chunk_schedule[chunk_id] = result;
-                    schedule_consumer[chunk_id] = 1;
+                    store_plan(chunk_id, result, planned_chunk_size);
                     std::vector<DimElapsedTime> myReordered;
                     myReordered.resize(dim_elapsed_time.size(),
                                        dim_elapsed_time[0]);
@@ -325,8 +322,53 @@ std::vector<int> OfflineGreedy::get_chunk_scheduling(
                 chunk_size *= dim_size[dim.dim_num];
             }
         }
-        chunk_schedule[chunk_id] = result;
-        schedule_consumer[chunk_id] = 1;
+        store_plan(chunk_id, result, planned_chunk_size);
         return result;
     }
 }
+
+ChunkPlan* OfflineGreedy::find_plan(long long chunk_id) {
+    if (chunk_id < first_chunk_id ||
+        chunk_id - first_chunk_id >= static_cast<long long>(plans.size())) {
+        return nullptr;
+    }
+    ChunkPlan* plan = &plans[chunk_id - first_chunk_id];
+    if (plan->consumers == static_cast<int64_t>(sys->all_sys.size())) {
+        return nullptr;
+    }
+    return plan;
+}
+
+void OfflineGreedy::store_plan(long long chunk_id,
+                               std::vector<int> schedule,
+                               uint64_t chunk_size) {
+    // Chunk ids that never ask for a plan (e.g. All-to-All streams) leave
+    // gaps; they are filled with plans that count as already consumed.
+    ChunkPlan consumed;
+    consumed.chunk_size = 0;
+    consumed.consumers = static_cast<int>(sys->all_sys.size());
+    if (plans.empty()) {
+        first_chunk_id = chunk_id;
+    }
+    while (chunk_id < first_chunk_id) {
+        plans.push_front(consumed);
+        first_chunk_id--;
+    }
+    while (chunk_id - first_chunk_id >= static_cast<long long>(plans.size())) {
+        plans.push_back(consumed);
+    }
+    ChunkPlan* plan = &plans[chunk_id - first_chunk_id];
+    plan->schedule = schedule;
+    plan->chunk_size = chunk_size;
+    plan->consumers = 0;
+    consume_plan(plan);
+}
+
+void OfflineGreedy::consume_plan(ChunkPlan* plan) {
+    plan->consumers++;
+    while (!plans.empty() && plans.front().consumers ==
+                                 static_cast<int64_t>(sys->all_sys.size())) {
+        plans.pop_front();
+        first_chunk_id++;
+    }
+}
@@ -6,6 +6,7 @@ LICENSE file in the root directory of this source tree.
 #ifndef __OFFLINE_GREEDY_HH__
 #define __OFFLINE_GREEDY_HH__
 
+#include <deque>
 #include <vector>
 
 #include "astra-sim/system/Common.hh"
@@ -22,6 +23,14 @@ class DimElapsedTime {
         return (elapsed_time < dimElapsedTime.elapsed_time);
     }
 };
+// Dimension order and size of a chunk, computed by rank 0 and consumed once
+// by every rank.
+class ChunkPlan {
+  public:
+    std::vector<int> schedule;
+    uint64_t chunk_size;
+    int consumers;
+};
 class OfflineGreedy {
   public:
     Sys* sys;
@@ -40,9 +49,17 @@ class OfflineGreedy {
     uint64_t get_chunk_size_from_elapsed_time(double elapsed_time,
                                               DimElapsedTime dim,
                                               ComType comm_type);
-    static std::map<long long, std::vector<int>> chunk_schedule;
-    static std::map<long long, int> schedule_consumer;
-    static std::map<long long, uint64_t> global_chunk_size;
+    ChunkPlan* find_plan(long long chunk_id);
+    void store_plan(long long chunk_id,
+                    std::vector<int> schedule,
+                    uint64_t chunk_size);
+    void consume_plan(ChunkPlan* plan);
+
+    // Plans of the chunks in flight, only kept by rank 0. Chunk ids are
+    // handed out in sequence, so plans[i] belongs to chunk first_chunk_id + i
+    // and fully consumed plans are dropped from the front in O(1).
+    std::deque<ChunkPlan> plans;
+    long long first_chunk_id;
 };
 
 }  // namespace AstraSim
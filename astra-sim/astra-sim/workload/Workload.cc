@@ -25,7 +25,8 @@ using json = nlohmann::json;
 typedef ChakraProtoMsg::NodeType ChakraNodeType;
 typedef ChakraProtoMsg::CollectiveCommType ChakraCollectiveCommType;
 
-Workload::Workload(Sys* sys, string et_filename, string comm_group_filename) {
+Workload::Workload(Sys* sys, string et_filename, string comm_group_filename)
+    : bus_stats(BusType::Shared, 0, 0, 0, 0) {
     string workload_filename = et_filename + "." + to_string(sys->id) + ".et";
     // Check if workload filename exists
     if (access(workload_filename.c_str(), R_OK) < 0) {
@@ -297,8 +298,32 @@ void Workload::issue_comm(shared_ptr<Chakra::ETFeederNode> node) {
             fp->set_notifier(this, EventType::CollectiveCommunicationFinished);
 
         } else if (node->comm_type() == ChakraCollectiveCommType::BROADCAST) {
-            // broadcast colelctive has not been implemented in ASTRA-SIM yet.
-            // So, we just use its real system mesurements
+            DataSet* fp = sys->generate_broadcast(
+                node->comm_size(), involved_dim, comm_group,
+                node->comm_priority(), get_collective_root(node));
+            collective_comm_node_id_map[fp->my_id] = node->id();
+            collective_comm_wrapper_map[fp->my_id] = fp;
+            fp->set_notifier(this, EventType::CollectiveCommunicationFinished);
+
+        } else if (node->comm_type() == ChakraCollectiveCommType::REDUCE) {
+            DataSet* fp = sys->generate_reduce(
+                node->comm_size(), involved_dim, comm_group,
+                node->comm_priority(), get_collective_root(node));
+            collective_comm_node_id_map[fp->my_id] = node->id();
+            collective_comm_wrapper_map[fp->my_id] = fp;
+            fp->set_notifier(this, EventType::CollectiveCommunicationFinished);
+
+        } else if (node->comm_type() == ChakraCollectiveCommType::GATHER) {
+            DataSet* fp = sys->generate_gather(
+                node->comm_size(), involved_dim, comm_group,
+                node->comm_priority(), get_collective_root(node));
+            collective_comm_node_id_map[fp->my_id] = node->id();
+            collective_comm_wrapper_map[fp->my_id] = fp;
+            fp->set_notifier(this, EventType::CollectiveCommunicationFinished);
+
+        } else {
+            // the remaining collectives have not been implemented in ASTRA-SIM
+            // yet. So, we just use their real system mesurements
             uint64_t runtime = 1ul;
             if (node->runtime() != 0ul) {
                 // chakra runtimes are in microseconds and we should convert it
@@ -347,6 +372,33 @@ void Workload::issue_comm(shared_ptr<Chakra::ETFeederNode> node) {
     }
 }
 
+int Workload::get_collective_root(shared_ptr<Chakra::ETFeederNode> node) {
+    // The root of a broadcast, reduce or gather is given by comm_src, as a
+    // rank within the communicator group if there is one. Without it, the
+    // first NPU of the communicator group (or NPU 0) is the root.
+    for (const auto& attr : node->getChakraNode()->attr()) {
+        if (attr.name() == "comm_src") {
+            int root = node->comm_src();
+            if (comm_group == nullptr) {
+                return root;
+            }
+            if (root < 0 ||
+                root >= static_cast<int>(comm_group->involved_NPUs.size())) {
+                LoggerFactory::get_logger("workload")
+                    ->critical("comm_src {} of node {} is not a rank of the "
+                               "communicator group",
+                               root, node->id());
+                exit(EXIT_FAILURE);
+            }
+            return comm_group->involved_NPUs[root];
+        }
+    }
+    if (comm_group != nullptr) {
+        return comm_group->involved_NPUs[0];
+    }
+    return 0;
+}
+
 void Workload::skip_invalid(shared_ptr<Chakra::ETFeederNode> node) {
     et_feeder->freeChildrenNodes(node->id());
     et_feeder->removeNode(node->id());
@@ -385,6 +437,10 @@ void Workload::call(EventType event, CallData* data) {
       
         // The Dataset class provides statistics that should be used later to dump
         // more statistics in the workload layer
+        if (sys->model_shared_bus) {
+            bus_stats.update_bus_stats(
+                BusType::Both, collective_comm_wrapper_map[coll_comm_id]);
+        }
         delete collective_comm_wrapper_map[coll_comm_id];
         collective_comm_wrapper_map.erase(coll_comm_id);
         et_feeder->removeNode(node_id);
@@ -439,4 +495,25 @@ void Workload::report() {
     LoggerFactory::get_logger("workload")
         ->info("sys[{}] finished, {} cycles, exposed communication {} cycles.",
                sys->id, curr_tick, curr_tick - hw_resource->tics_gpu_ops);
+    if (sys->model_shared_bus) {
+        LoggerFactory::get_logger("workload")
+            ->info("sys[{}] shared bus delays: transfer queue {:.2f}, transfer "
+                   "{:.2f}, processing queue {:.2f}, processing {:.2f}.",
+                   sys->id, bus_stats.total_shared_bus_transfer_queue_delay,
+                   bus_stats.total_shared_bus_transfer_delay,
+                   bus_stats.total_shared_bus_processing_queue_delay,
+                   bus_stats.total_shared_bus_processing_delay);
+        LoggerFactory::get_logger("workload")
+            ->info("sys[{}] mem bus delays: transfer queue {:.2f}, transfer "
+                   "{:.2f}, processing queue {:.2f}, processing {:.2f}.",
+                   sys->id, bus_stats.total_mem_bus_transfer_queue_delay,
+                   bus_stats.total_mem_bus_transfer_delay,
+                   bus_stats.total_mem_bus_processing_queue_delay,
+                   bus_stats.total_mem_bus_processing_delay);
+    }
+    if (Sys::collective_cost_cache != nullptr) {
+        LoggerFactory::get_logger("workload")
+            ->info("sys[{}] collective cost cache: {} hits, {} misses.",
+                   sys->id, sys->cost_cache_hits, sys->cost_cache_misses);
+    }
 }
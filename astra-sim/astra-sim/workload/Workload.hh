@@ -12,6 +12,7 @@ LICENSE file in the root directory of this source tree.
 
 #include "astra-sim/system/Callable.hh"
 #include "astra-sim/system/CommunicatorGroup.hh"
+#include "astra-sim/system/SharedBusStat.hh"
 #include "astra-sim/workload/HardwareResource.hh"
 #include "extern/graph_frontend/chakra/src/feeder/et_feeder.h"
 
@@ -37,6 +38,7 @@ class Workload : public Callable {
     void issue_remote_mem(std::shared_ptr<Chakra::ETFeederNode> node);
     void issue_comp(std::shared_ptr<Chakra::ETFeederNode> node);
     void issue_comm(std::shared_ptr<Chakra::ETFeederNode> node);
+    int get_collective_root(std::shared_ptr<Chakra::ETFeederNode> node);
     void skip_invalid(std::shared_ptr<Chakra::ETFeederNode> node);
     void call(EventType event, CallData* data);
     void fire();
@@ -50,6 +52,8 @@ class Workload : public Callable {
     Sys* sys;
     std::unordered_map<int, uint64_t> collective_comm_node_id_map;
     std::unordered_map<int, DataSet*> collective_comm_wrapper_map;
+    // bus delays of the finished collectives, if the shared bus is modeled
+    SharedBusStat bus_stats;
     bool is_finished;
 };
 
@@ -8,9 +8,10 @@ LICENSE file in the root directory of this source tree.
 
 using namespace NetworkAnalytical;
 
-Event::Event(const Callback callback, const CallbackArg callback_arg) noexcept
+Event::Event(const Callback callback, const CallbackArg callback_arg, const EventSequence sequence) noexcept
     : callback(callback),
-      callback_arg(callback_arg) {
+      callback_arg(callback_arg),
+      sequence(sequence) {
     assert(callback != nullptr);
 }
 
@@ -28,3 +29,7 @@ std::pair<Callback, CallbackArg> Event::get_handler_arg() const noexcept {
 
     return {callback, callback_arg};
 }
+
+EventSequence Event::get_sequence() const noexcept {
+    return sequence;
+}
@@ -5,6 +5,7 @@ LICENSE file in the root directory of this source tree.
 
 #include "common/EventList.h"
 #include <cassert>
+#include <iterator>
 
 using namespace NetworkAnalytical;
 
@@ -19,16 +20,25 @@ EventTime EventList::get_event_time() const noexcept {
     return event_time;
 }
 
-void EventList::add_event(const Callback callback, const CallbackArg callback_arg) noexcept {
+void EventList::add_event(const Callback callback,
+                          const CallbackArg callback_arg,
+                          const EventSequence sequence) noexcept {
     assert(callback != nullptr);
 
+    // find the position of the event, which is the end unless its sequence was reserved earlier
+    auto event_it = events.end();
+    while (event_it != events.begin() && std::prev(event_it)->get_sequence() > sequence) {
+        event_it--;
+    }
+
     // add the event to the event list
-    events.emplace_back(callback, callback_arg);
+    events.emplace(event_it, callback, callback_arg, sequence);
 }
 
-void EventList::invoke_events() noexcept {
+void EventList::invoke_events(EventSequence& current_sequence) noexcept {
     // invoke all events in the event list
     while (!events.empty()) {
+        current_sequence = events.front().get_sequence();
         events.front().invoke_event();
         events.pop_front();
     }
@@ -8,7 +8,7 @@ LICENSE file in the root directory of this source tree.
 
 using namespace NetworkAnalytical;
 
-EventQueue::EventQueue() noexcept : current_time(0) {
+EventQueue::EventQueue() noexcept : current_time(0), current_sequence(0), next_sequence(1) {
     // create empty event queue
     event_queue = std::list<EventList>();
 }
@@ -34,7 +34,7 @@ void EventQueue::proceed() noexcept {
     current_time = current_event_list.get_event_time();
 
     // invoke events
-    current_event_list.invoke_events();
+    current_event_list.invoke_events(current_sequence);
 
     // drop processed event list
     event_queue.pop_front();
@@ -43,6 +43,23 @@ void EventQueue::proceed() noexcept {
 void EventQueue::schedule_event(const EventTime event_time,
                                 const Callback callback,
                                 const CallbackArg callback_arg) noexcept {
+    schedule_event(event_time, callback, callback_arg, reserve_sequence());
+}
+
+EventSequence EventQueue::reserve_sequence() noexcept {
+    return next_sequence++;
+}
+
+EventSequence EventQueue::get_current_sequence() const noexcept {
+    return current_sequence;
+}
+
+void EventQueue::schedule_event(const EventTime event_time,
+                                const Callback callback,
+                                const CallbackArg callback_arg,
+                                const EventSequence sequence) noexcept {
+    assert(sequence < next_sequence);
+
     // time should be at least larger than current time
     assert(event_time >= current_time);
 
@@ -67,5 +84,5 @@ void EventQueue::schedule_event(const EventTime event_time,
 
     // now, whether (1) or (2), the entry to insert the event is found
     // add event to event_list
-    event_list_it->add_event(callback, callback_arg);
+    event_list_it->add_event(callback, callback_arg, sequence);
 }
@@ -6,15 +6,27 @@ LICENSE file in the root directory of this source tree.
 #include "common/NetworkParser.h"
 #include <cassert>
 #include <iostream>
+#include <set>
+#include <utility>
 
 using namespace NetworkAnalytical;
 
-NetworkParser::NetworkParser(const std::string& path) noexcept : dims_count(-1) {
+NetworkParser::NetworkParser(const std::string& path) noexcept
+    : dims_count(-1),
+      routing_policy(RoutingPolicy::Deterministic),
+      link_telemetry_path(),
+      link_buffer_size(0),
+      contention_window(0),
+      graph(false),
+      graph_npus_count(-1),
+      graph_switches_count(0) {
     // initialize values
     npus_count_per_dim = {};
     bandwidth_per_dim = {};
     latency_per_dim = {};
     topology_per_dim = {};
+    graph_links = {};
+    link_overrides = {};
 
     try {
         // load network config file
@@ -63,7 +75,116 @@ std::vector<TopologyBuildingBlock> NetworkParser::get_topologies_per_dim() const
     return topology_per_dim;
 }
 
+RoutingPolicy NetworkParser::get_routing_policy() const noexcept {
+    return routing_policy;
+}
+
+std::string NetworkParser::get_link_telemetry_path() const noexcept {
+    return link_telemetry_path;
+}
+
+std::vector<LinkOverride> NetworkParser::get_link_overrides() const noexcept {
+    return link_overrides;
+}
+
+ChunkSize NetworkParser::get_link_buffer_size() const noexcept {
+    return link_buffer_size;
+}
+
+EventTime NetworkParser::get_contention_window() const noexcept {
+    return contention_window;
+}
+
+bool NetworkParser::is_graph() const noexcept {
+    return graph;
+}
+
+int NetworkParser::get_graph_npus_count() const noexcept {
+    assert(graph);
+
+    return graph_npus_count;
+}
+
+int NetworkParser::get_graph_switches_count() const noexcept {
+    assert(graph);
+
+    return graph_switches_count;
+}
+
+std::vector<GraphLink> NetworkParser::get_graph_links() const noexcept {
+    assert(graph);
+
+    return graph_links;
+}
+
 void NetworkParser::parse_network_config_yml(const YAML::Node& network_config) noexcept {
+    // parse routing policy
+    if (network_config["routing"]) {
+        try {
+            routing_policy = NetworkParser::parse_routing_policy_name(network_config["routing"].as<std::string>());
+        } catch (const YAML::BadConversion& e) {
+            // error reading the routing policy from the yaml file
+            std::cerr << "[Error] (network/analytical) " << e.what() << std::endl;
+            std::exit(-1);
+        }
+    }
+
+    // parse link telemetry file
+    if (network_config["link_telemetry"]) {
+        try {
+            link_telemetry_path = network_config["link_telemetry"].as<std::string>();
+        } catch (const YAML::BadConversion& e) {
+            // error reading the link telemetry file from the yaml file
+            std::cerr << "[Error] (network/analytical) " << e.what() << std::endl;
+            std::exit(-1);
+        }
+    }
+
+    // parse link buffer size
+    if (network_config["link_buffer_size"]) {
+        try {
+            const auto buffer_size = network_config["link_buffer_size"].as<int64_t>();
+            if (buffer_size <= 0) {
+                std::cerr << "[Error] (network/analytical) " << "link_buffer_size (" << buffer_size
+                          << ") should be larger than 0" << std::endl;
+                std::exit(-1);
+            }
+            link_buffer_size = static_cast<ChunkSize>(buffer_size);
+        } catch (const YAML::BadConversion& e) {
+            // error reading the link buffer size from the yaml file
+            std::cerr << "[Error] (network/analytical) " << e.what() << std::endl;
+            std::exit(-1);
+        }
+    }
+
+    // parse contention window
+    if (network_config["contention_window"]) {
+        try {
+            const auto window = network_config["contention_window"].as<int64_t>();
+            if (window <= 0) {
+                std::cerr << "[Error] (network/analytical) " << "contention_window (" << window
+                          << ") should be larger than 0" << std::endl;
+                std::exit(-1);
+            }
+            contention_window = static_cast<EventTime>(window);
+        } catch (const YAML::BadConversion& e) {
+            // error reading the contention window from the yaml file
+            std::cerr << "[Error] (network/analytical) " << e.what() << std::endl;
+            std::exit(-1);
+        }
+    }
+
+    // parse per-link overrides
+    if (network_config["link_overrides"]) {
+        parse_link_overrides_yml(network_config);
+    }
+
+    // a graph replaces the per-dimension building blocks
+    if (network_config["graph"]) {
+        parse_graph_config_yml(network_config);
+        return;
+    }
+
     // parse topology_per_dim
     const auto topology_names = parse_vector<std::string>(network_config["topology"]);
     for (const auto& topology_name : topology_names) {
@@ -83,6 +204,110 @@ void NetworkParser::parse_network_config_yml(const YAML::Node& network_config) n
     check_validity();
 }
 
+void NetworkParser::parse_link_overrides_yml(const YAML::Node& network_config) noexcept {
+    try {
+        for (const auto& link : network_config["link_overrides"]) {
+            auto link_override = LinkOverride{link["src"].as<DeviceId>(), link["dest"].as<DeviceId>(), std::nullopt,
+                                              std::nullopt, true};
+            if (link["bandwidth"]) {
+                link_override.bandwidth = link["bandwidth"].as<Bandwidth>();
+            }
+            if (link["latency"]) {
+                link_override.latency = link["latency"].as<Latency>();
+            }
+            if (link["bidirectional"]) {
+                link_override.bidirectional = link["bidirectional"].as<bool>();
+            }
+            link_overrides.push_back(link_override);
+        }
+    } catch (const YAML::Exception& e) {
+        // error reading the link overrides from the yaml file
+        std::cerr << "[Error] (network/analytical) " << e.what() << std::endl;
+        std::exit(-1);
+    }
+
+    check_link_overrides_validity();
+}
+
+void NetworkParser::parse_graph_config_yml(const YAML::Node& network_config) noexcept {
+    graph = true;
+
+    if (network_config["topology"]) {
+        std::cerr << "[Error] (network/analytical) " << "topology can not be combined with graph" << std::endl;
+        std::exit(-1);
+    }
+
+    try {
+        // parse devices
+        const auto& graph_config = network_config["graph"];
+        graph_npus_count = graph_config["npus_count"].as<int>();
+        if (graph_config["switches_count"]) {
+            graph_switches_count = graph_config["switches_count"].as<int>();
+        }
+
+        // parse links
+        for (const auto& link : graph_config["links"]) {
+            auto bidirectional = true;
+            if (link["bidirectional"]) {
+                bidirectional = link["bidirectional"].as<bool>();
+            }
+            graph_links.push_back({link["src"].as<DeviceId>(), link["dest"].as<DeviceId>(),
+                                   link["bandwidth"].as<Bandwidth>(), link["latency"].as<Latency>(), bidirectional});
+        }
+    } catch (const YAML::Exception& e) {
+        // error reading the graph from the yaml file
+        std::cerr << "[Error] (network/analytical) " << e.what() << std::endl;
+        std::exit(-1);
+    }
+
+    check_graph_validity();
+
+    // by default, all NPUs form a single dimension
+    if (network_config["npus_count"]) {
+        npus_count_per_dim = parse_vector<int>(network_config["npus_count"]);
+    } else {
+        npus_count_per_dim = {graph_npus_count};
+    }
+    dims_count = static_cast<int>(npus_count_per_dim.size());
+
+    // by default, each dimension sees the slowest link attached to an NPU
+    auto npu_bandwidth = -1.0;
+    auto npu_latency = -1.0;
+    for (const auto& link : graph_links) {
+        if (link.src < graph_npus_count || link.dest < graph_npus_count) {
+            if (npu_bandwidth < 0 || link.bandwidth < npu_bandwidth) {
+                npu_bandwidth = link.bandwidth;
+            }
+            if (npu_latency < 0 || link.latency > npu_latency) {
+                npu_latency = link.latency;
+            }
+        }
+    }
+    if (network_config["bandwidth"]) {
+        bandwidth_per_dim = parse_vector<Bandwidth>(network_config["bandwidth"]);
+    } else {
+        bandwidth_per_dim = std::vector<Bandwidth>(dims_count, npu_bandwidth);
+    }
+    if (network_config["latency"]) {
+        latency_per_dim = parse_vector<Latency>(network_config["latency"]);
+    } else {
+        latency_per_dim = std::vector<Latency>(dims_count, npu_latency);
+    }
+
+    // check the validity of the dimensions
+    check_validity();
+
+    auto npus_count = 1;
+    for (const auto& npus_count_of_dim : npus_count_per_dim) {
+        npus_count *= npus_count_of_dim;
+    }
+    if (npus_count != graph_npus_count) {
+        std::cerr << "[Error] (network/analytical) " << "npus_count of the dimensions (" << npus_count
+                  << ") doesn't match with npus_count of the graph (" << graph_npus_count << ")" << std::endl;
+        std::exit(-1);
+    }
+}
+
 TopologyBuildingBlock NetworkParser::parse_topology_name(const std::string& topology_name) noexcept {
     assert(!topology_name.empty());
 
@@ -123,6 +348,25 @@ TopologyBuildingBlock NetworkParser::parse_topology_name(const std::string& topo
     std::exit(-1);
 }
 
+RoutingPolicy NetworkParser::parse_routing_policy_name(const std::string& routing_policy_name) noexcept {
+    if (routing_policy_name == "deterministic") {
+        return RoutingPolicy::Deterministic;
+    }
+
+    if (routing_policy_name == "ecmp") {
+        return RoutingPolicy::Ecmp;
+    }
+
+    if (routing_policy_name == "spray") {
+        return RoutingPolicy::Spray;
+    }
+
+    // shouldn't reach here
+    std::cerr << "[Error] (network/analytical) " << "Routing policy " << routing_policy_name << " not supported"
+              << std::endl;
+    std::exit(-1);
+}
+
 void NetworkParser::check_validity() const noexcept {
     // dims_count should match
     if (dims_count != npus_count_per_dim.size()) {
@@ -170,3 +414,80 @@ void NetworkParser::check_validity() const noexcept {
         }
     }
 }
+
+void NetworkParser::check_link_overrides_validity() const noexcept {
+    for (const auto& link : link_overrides) {
+        if (link.src < 0 || link.dest < 0 || link.src == link.dest) {
+            std::cerr << "[Error] (network/analytical) " << "overridden link (" << link.src << " -> " << link.dest
+                      << ") should connect two different devices" << std::endl;
+            std::exit(-1);
+        }
+
+        if (!link.bandwidth.has_value() && !link.latency.has_value()) {
+            std::cerr << "[Error] (network/analytical) " << "override of link (" << link.src << " -> " << link.dest
+                      << ") should give a bandwidth or a latency" << std::endl;
+            std::exit(-1);
+        }
+
+        if (link.bandwidth.has_value() && link.bandwidth.value() <= 0) {
+            std::cerr << "[Error] (network/analytical) " << "bandwidth of overridden link (" << link.src << " -> "
+                      << link.dest << ") should be larger than 0" << std::endl;
+            std::exit(-1);
+        }
+
+        if (link.latency.has_value() && link.latency.value() < 0) {
+            std::cerr << "[Error] (network/analytical) " << "latency of overridden link (" << link.src << " -> "
+                      << link.dest << ") should be non-negative" << std::endl;
+            std::exit(-1);
+        }
+    }
+}
+
+void NetworkParser::check_graph_validity() const noexcept {
+    if (graph_npus_count <= 1) {
+        std::cerr << "[Error] (network/analytical) " << "npus_count of the graph (" << graph_npus_count
+                  << ") should be larger than 1" << std::endl;
+        std::exit(-1);
+    }
+
+    if (graph_switches_count < 0) {
+        std::cerr << "[Error] (network/analytical) " << "switches_count of the graph (" << graph_switches_count
+                  << ") should be non-negative" << std::endl;
+        std::exit(-1);
+    }
+
+    // a device keeps one link per peer, so parallel links are rejected
+    // instead of silently dropping all but the first
+    auto connected = std::set<std::pair<DeviceId, DeviceId>>();
+
+    const auto devices_count = graph_npus_count + graph_switches_count;
+    for (const auto& link : graph_links) {
+        if (link.src < 0 || link.src >= devices_count || link.dest < 0 || link.dest >= devices_count ||
+            link.src == link.dest) {
+            std::cerr << "[Error] (network/analytical) " << "link (" << link.src << " -> " << link.dest
+                      << ") should connect two different devices between 0 and " << devices_count - 1
+                      << std::endl;
+            std::exit(-1);
+        }
+
+        if (!connected.emplace(link.src, link.dest).second ||
+            (link.bidirectional && !connected.emplace(link.dest, link.src).second)) {
+            std::cerr << "[Error] (network/analytical) " << "link (" << link.src << " -> " << link.dest
+                      << ") is given more than once, merge parallel links into one with their total bandwidth"
+                      << std::endl;
+            std::exit(-1);
+        }
+
+        if (link.bandwidth <= 0) {
+            std::cerr << "[Error] (network/analytical) " << "bandwidth of link (" << link.src << " -> " << link.dest
+                      << ") should be larger than 0" << std::endl;
+            std::exit(-1);
+        }
+
+        if (link.latency < 0) {
+            std::cerr << "[Error] (network/analytical) " << "latency of link (" << link.src << " -> " << link.dest
+                      << ") should be non-negative" << std::endl;
+            std::exit(-1);
+        }
+    }
+}
@@ -42,9 +42,6 @@ Route Ring::route(DeviceId src, DeviceId dest) const noexcept {
     assert(0 <= src && src < npus_count);
     assert(0 <= dest && dest < npus_count);
 
-    // construct empty route
-    auto route = Route();
-
     auto step = 1;  // default direction: clockwise
     if (bidirectional) {
         // check whether going anticlockwise is shorter
@@ -60,6 +57,31 @@ Route Ring::route(DeviceId src, DeviceId dest) const noexcept {
         }
     }
 
+    return route_in_direction(src, dest, step);
+}
+
+Route Ring::route_with_hash(DeviceId src, DeviceId dest, uint64_t hash) const noexcept {
+    // assert npus are in valid range
+    assert(0 <= src && src < npus_count);
+    assert(0 <= dest && dest < npus_count);
+
+    // both directions are equally short only halfway around the ring
+    auto clockwise_dist = dest - src;
+    if (clockwise_dist < 0) {
+        clockwise_dist += npus_count;
+    }
+    if (!bidirectional || clockwise_dist == 0 || 2 * clockwise_dist != npus_count) {
+        return route(src, dest);
+    }
+
+    const auto step = mix_hash(hash, src) % 2 == 0 ? 1 : -1;
+    return route_in_direction(src, dest, step);
+}
+
+Route Ring::route_in_direction(DeviceId src, DeviceId dest, int step) const noexcept {
+    // construct empty route
+    auto route = Route();
+
     // construct the route
     auto current = src;
     while (current != dest) {
@@ -0,0 +1,162 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#include "congestion_aware/GraphTopology.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <queue>
+#include <tuple>
+#include <utility>
+
+using namespace NetworkAnalyticalCongestionAware;
+
+GraphTopology::GraphTopology(const int npus_count,
+                             const int switches_count,
+                             const std::vector<GraphLink>& links,
+                             const std::vector<int>& npus_count_per_dim,
+                             const std::vector<Bandwidth>& bandwidth_per_dim) noexcept
+    : Topology() {
+    assert(npus_count > 0);
+    assert(switches_count >= 0);
+    assert(npus_count_per_dim.size() == bandwidth_per_dim.size());
+
+    // setup npus and devices count
+    this->npus_count = npus_count;
+    this->devices_count = npus_count + switches_count;
+    this->dims_count = static_cast<int>(npus_count_per_dim.size());
+    this->npus_count_per_dim = npus_count_per_dim;
+    this->bandwidth_per_dim = bandwidth_per_dim;
+
+    // instantiate devices and connect them
+    instantiate_devices();
+    for (const auto& link : links) {
+        connect(link.src, link.dest, link.bandwidth, link.latency, link.bidirectional);
+    }
+
+    build_routing_tables(links);
+}
+
+Route GraphTopology::route(const DeviceId src, const DeviceId dest) const noexcept {
+    // assert npus are in valid range
+    assert(0 <= src && src < npus_count);
+    assert(0 <= dest && dest < npus_count);
+
+    // follow the routing table towards dest, taking the lowest id
+    auto route = Route();
+    auto current = src;
+    route.push_back(devices.at(current));
+    while (current != dest) {
+        const auto offset = next_hops_offset[dest][current];
+        assert(offset < next_hops_offset[dest][current + 1]);
+        current = next_hops[dest][offset];
+        route.push_back(devices.at(current));
+    }
+
+    return route;
+}
+
+Route GraphTopology::route_with_hash(const DeviceId src, const DeviceId dest, const uint64_t hash) const noexcept {
+    // assert npus are in valid range
+    assert(0 <= src && src < npus_count);
+    assert(0 <= dest && dest < npus_count);
+
+    // follow the routing table towards dest, picking by the hash at each device
+    auto route = Route();
+    auto current = src;
+    route.push_back(devices.at(current));
+    while (current != dest) {
+        const auto offset = next_hops_offset[dest][current];
+        const auto candidates_count = next_hops_offset[dest][current + 1] - offset;
+        assert(candidates_count > 0);
+        current = next_hops[dest][offset + mix_hash(hash, current) % candidates_count];
+        route.push_back(devices.at(current));
+    }
+
+    return route;
+}
+
+int GraphTopology::get_hops_count(const DeviceId src, const DeviceId dest) const noexcept {
+    // assert npus are in valid range
+    assert(0 <= src && src < npus_count);
+    assert(0 <= dest && dest < npus_count);
+
+    // every equal-cost route has the same hops, so follow the lowest id
+    auto hops_count = 0;
+    for (auto current = src; current != dest; current = next_hops[dest][next_hops_offset[dest][current]]) {
+        hops_count++;
+    }
+    return hops_count;
+}
+
+void GraphTopology::build_routing_tables(const std::vector<GraphLink>& links) noexcept {
+    // incoming links of each device, as (src, latency)
+    auto incoming_links = std::vector<std::vector<std::pair<DeviceId, Latency>>>(devices_count);
+    for (const auto& link : links) {
+        incoming_links[link.dest].emplace_back(link.src, link.latency);
+        if (link.bidirectional) {
+            incoming_links[link.src].emplace_back(link.dest, link.latency);
+        }
+    }
+
+    // path cost as (hops, latency)
+    using Cost = std::pair<int, Latency>;
+    const auto unreachable = Cost(-1, 0);
+
+    next_hops.resize(npus_count);
+    next_hops_offset.resize(npus_count);
+    for (auto dest = 0; dest < npus_count; dest++) {
+        // shortest paths from every device to dest, over the reversed links
+        auto cost = std::vector<Cost>(devices_count, unreachable);
+        auto next = std::vector<std::vector<DeviceId>>(devices_count);
+
+        auto queue = std::priority_queue<std::tuple<Cost, DeviceId>, std::vector<std::tuple<Cost, DeviceId>>,
+                                         std::greater<std::tuple<Cost, DeviceId>>>();
+        cost[dest] = Cost(0, 0);
+        queue.emplace(cost[dest], dest);
+        while (!queue.empty()) {
+            const auto [current_cost, device] = queue.top();
+            queue.pop();
+            if (current_cost != cost[device]) {
+                // stale entry
+                continue;
+            }
+
+            for (const auto& [prev, latency] : incoming_links[device]) {
+                const auto candidate = Cost(current_cost.first + 1, current_cost.second + latency);
+                if (cost[prev] == unreachable || candidate < cost[prev]) {
+                    cost[prev] = candidate;
+                    next[prev] = {device};
+                    queue.emplace(candidate, prev);
+                } else if (candidate == cost[prev]) {
+                    // another equal-cost next device
+                    next[prev].push_back(device);
+                }
+            }
+        }
+
+        // every NPU should reach dest
+        for (auto src = 0; src < npus_count; src++) {
+            if (cost[src] == unreachable) {
+                std::cerr << "[Error] (network/analytical/congestion_aware) " << "NPU " << src
+                          << " can't reach NPU " << dest << " in the graph" << std::endl;
+                std::exit(-1);
+            }
+        }
+
+        // store the next devices in increasing id order
+        auto& offsets = next_hops_offset[dest];
+        offsets.assign(devices_count + 1, 0);
+        for (auto device = 0; device < devices_count; device++) {
+            auto& candidates = next[device];
+            std::sort(candidates.begin(), candidates.end());
+            candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+            next_hops[dest].insert(next_hops[dest].end(), candidates.begin(), candidates.end());
+            offsets[device + 1] = static_cast<int>(next_hops[dest].size());
+        }
+    }
+}
@@ -27,6 +27,49 @@ MultiDimTopology::MultiDimTopology() noexcept : Topology() {
 }
 
 Route MultiDimTopology::route(DeviceId src, DeviceId dest) const noexcept {
+    // traverse the highest dimension first
+    auto dims_order = std::vector<int>();
+    for (int dim = dims_count - 1; dim >= 0; dim--) {
+        dims_order.push_back(dim);
+    }
+
+    return build_route(src, dest, dims_order, std::nullopt);
+}
+
+Route MultiDimTopology::route_with_hash(DeviceId src, DeviceId dest, uint64_t hash) const noexcept {
+    // every order of the dimensions takes the same hops, so shuffle it by the hash
+    auto dims_order = std::vector<int>();
+    for (int dim = dims_count - 1; dim >= 0; dim--) {
+        dims_order.push_back(dim);
+    }
+    for (int i = dims_count - 1; i > 0; i--) {
+        std::swap(dims_order.at(i), dims_order.at(mix_hash(hash, i) % (i + 1)));
+    }
+
+    return build_route(src, dest, dims_order, hash);
+}
+
+int MultiDimTopology::get_hops_count(const DeviceId src, const DeviceId dest) const noexcept {
+    assert(0 <= src && src < npus_count);
+    assert(0 <= dest && dest < npus_count);
+
+    const auto src_address = translate_address(src);
+    const auto dest_address = translate_address(dest);
+
+    // count the hops within each dimension the addresses differ in
+    auto hops_count = 0;
+    for (int dim = 0; dim < dims_count; dim++) {
+        if (src_address.at(dim) != dest_address.at(dim)) {
+            hops_count += m_topology_per_dim.at(dim)->get_hops_count(src_address.at(dim), dest_address.at(dim));
+        }
+    }
+    return hops_count;
+}
+
+Route MultiDimTopology::build_route(DeviceId src,
+                                    DeviceId dest,
+                                    const std::vector<int>& dims_order,
+                                    std::optional<uint64_t> hash) const noexcept {
     // // assert npus are in valid range
     assert(0 <= src && src < npus_count);
     assert(0 <= dest && dest < npus_count);
@@ -41,7 +84,7 @@ Route MultiDimTopology::route(DeviceId src, DeviceId dest) const noexcept {
     MultiDimAddress last_dest_address{src_address};
     DeviceId last_dest{src};
 
-    for (int dim_to_transfer = dims_count - 1; dim_to_transfer >= 0; dim_to_transfer--) {
+    for (const auto dim_to_transfer : dims_order) {
         // if dimension same, skip
         if (src_address.at(dim_to_transfer) != dest_address.at(dim_to_transfer)) {
             // find destination in next dimension
@@ -50,9 +93,12 @@ Route MultiDimTopology::route(DeviceId src, DeviceId dest) const noexcept {
 
             // create internal route from current dimension
             auto* const topology = m_topology_per_dim.at(dim_to_transfer).get();
-            auto internal_route =
-                topology->route(last_dest_address.at(dim_to_transfer),
-                                next_dim_dest_address.at(dim_to_transfer));  // route on that dimension
+            const auto internal_src = last_dest_address.at(dim_to_transfer);
+            const auto internal_dest = next_dim_dest_address.at(dim_to_transfer);
+            // route on that dimension
+            auto internal_route = hash.has_value() ? topology->route_with_hash(internal_src, internal_dest,
+                                                                               mix_hash(hash.value(), dim_to_transfer))
+                                                   : topology->route(internal_src, internal_dest);
             auto route_in_dim = Route();
 
             // translate internal route device id to global device IDs and push to route in this dimension
@@ -34,7 +34,8 @@ Chunk::Chunk(const ChunkSize chunk_size, Route route, const Callback callback, c
     : chunk_size(chunk_size),
       route(std::move(route)),
       callback(callback),
-      callback_arg(callback_arg) {
+      callback_arg(callback_arg),
+      buffering_link(nullptr) {
     assert(chunk_size > 0);
     assert(!this->route.empty());
     assert(callback != nullptr);
@@ -73,6 +74,19 @@ bool Chunk::arrived_dest() const noexcept {
     return route.size() == 1;
 }
 
+bool Chunk::next_device_is_dest() const noexcept {
+    // only the current and dest node are left
+    return route.size() == 2;
+}
+
+Link* Chunk::get_buffering_link() const noexcept {
+    return buffering_link;
+}
+
+void Chunk::set_buffering_link(Link* const link) noexcept {
+    buffering_link = link;
+}
+
 ChunkSize Chunk::get_size() const noexcept {
     assert(chunk_size > 0);
 
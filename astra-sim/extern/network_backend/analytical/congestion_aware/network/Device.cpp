@@ -59,6 +59,10 @@ void Device::connect(const DeviceId id, const Bandwidth bandwidth, const Latency
     links[id] = std::make_shared<Link>(bandwidth, latency);
 }
 
+const std::map<DeviceId, std::shared_ptr<Link>>& Device::get_links() const noexcept {
+    return links;
+}
+
 bool Device::connected(const DeviceId dest) const noexcept {
     assert(dest >= 0);
 
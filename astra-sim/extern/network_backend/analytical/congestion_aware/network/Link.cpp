@@ -7,6 +7,7 @@ LICENSE file in the root directory of this source tree.
 #include "common/NetworkFunction.h"
 #include "congestion_aware/Chunk.h"
 #include "congestion_aware/Device.h"
+#include <algorithm>
 #include <cassert>
 
 using namespace NetworkAnalytical;
@@ -15,6 +16,12 @@ using namespace NetworkAnalyticalCongestionAware;
 // declaring static event_queue
 std::shared_ptr<EventQueue> Link::event_queue;
 
+// declaring static telemetry_enabled
+bool Link::telemetry_enabled = false;
+
+// declaring static buffer_size
+ChunkSize Link::buffer_size = 0;
+
 void Link::link_become_free(void* const link_ptr) noexcept {
     assert(link_ptr != nullptr);
 
@@ -22,12 +29,23 @@ void Link::link_become_free(void* const link_ptr) noexcept {
     auto* const link = static_cast<Link*>(link_ptr);
 
     // set link free
+    link->free_event_scheduled = false;
     link->set_free();
 
+    // the serialized chunk left the buffer of this device
+    auto* const buffering_link = link->serializing_chunk_buffering_link;
+    const auto buffered_chunk_size = link->serializing_chunk_size;
+    link->serializing_chunk_buffering_link = nullptr;
+
     // process pending chunks if one exist
-    if (link->pending_chunk_exists()) {
+    if (link->pending_chunk_exists() && link->buffer_available(*link->pending_chunks.front())) {
         link->process_pending_transmission();
     }
+
+    // let the upstream link resume
+    if (buffering_link != nullptr) {
+        buffering_link->release_buffer(buffered_chunk_size);
+    }
 }
 
 void Link::set_event_queue(std::shared_ptr<EventQueue> event_queue_ptr) noexcept {
@@ -37,11 +55,27 @@ void Link::set_event_queue(std::shared_ptr<EventQueue> event_queue_ptr) noexcept
     Link::event_queue = std::move(event_queue_ptr);
 }
 
+void Link::set_telemetry_enabled(const bool enabled) noexcept {
+    Link::telemetry_enabled = enabled;
+}
+
+void Link::set_buffer_size(const ChunkSize size) noexcept {
+    Link::buffer_size = size;
+}
+
 Link::Link(const Bandwidth bandwidth, const Latency latency) noexcept
     : bandwidth(bandwidth),
       latency(latency),
       pending_chunks(),
-      busy(false) {
+      busy(false),
+      busy_until(0),
+      free_event_sequence(0),
+      free_event_scheduled(false),
+      telemetry(),
+      buffer_occupancy(0),
+      serializing_chunk_buffering_link(nullptr),
+      serializing_chunk_size(0),
+      pending_chunks_updated_time(0) {
     assert(bandwidth > 0);
     assert(latency >= 0);
 
@@ -52,19 +86,69 @@ Link::Link(const Bandwidth bandwidth, const Latency latency) noexcept
 void Link::send(std::unique_ptr<Chunk> chunk) noexcept {
     assert(chunk != nullptr);
 
-    if (busy) {
-        // link is busy, add to pending chunks
+    // without a scheduled free event, the link became free once its serialization finished
+    if (busy && !free_event_scheduled && serialization_finished()) {
+        set_free();
+    }
+
+    if (busy || pending_chunk_exists() || !buffer_available(*chunk)) {
+        // link is busy or blocked, add to pending chunks
+        if (Link::telemetry_enabled) {
+            update_queueing_delay();
+            const auto pending_chunks_count = static_cast<uint64_t>(pending_chunks.size() + 1);
+            telemetry.max_pending_chunks = std::max(telemetry.max_pending_chunks, pending_chunks_count);
+        }
         pending_chunks.push_back(std::move(chunk));
+
+        // the chunk has to be picked up once the link becomes free
+        if (busy && !free_event_scheduled) {
+            schedule_link_free();
+        }
     } else {
         // service this chunk immediately
         schedule_chunk_transmission(std::move(chunk));
     }
 }
 
+bool Link::try_send_single_hop(const ChunkSize chunk_size,
+                              const Callback callback,
+                              const CallbackArg callback_arg) noexcept {
+    assert(chunk_size > 0);
+    assert(callback != nullptr);
+
+    // telemetry and finite buffers account the chunk object
+    if (Link::telemetry_enabled || Link::buffer_size > 0) {
+        return false;
+    }
+
+    // without a scheduled free event, the link became free once its serialization finished
+    if (busy && !free_event_scheduled && serialization_finished()) {
+        set_free();
+    }
+
+    // the chunk would have to wait
+    if (busy || pending_chunk_exists()) {
+        return false;
+    }
+
+    // as schedule_chunk_transmission, with the arrival at the destination invoking the callback directly
+    set_busy();
+    const auto current_time = Link::event_queue->get_current_time();
+    Link::event_queue->schedule_event(current_time + communication_delay(chunk_size), callback, callback_arg);
+    busy_until = current_time + serialization_delay(chunk_size);
+    free_event_sequence = Link::event_queue->reserve_sequence();
+
+    return true;
+}
+
 void Link::process_pending_transmission() noexcept {
     // pending chunk should exist
     assert(pending_chunk_exists());
 
+    if (Link::telemetry_enabled) {
+        update_queueing_delay();
+    }
+
     // get chunk to process
     auto chunk = std::move(pending_chunks.front());
     pending_chunks.pop_front();
@@ -78,6 +162,10 @@ bool Link::pending_chunk_exists() const noexcept {
     return !pending_chunks.empty();
 }
 
+uint64_t Link::get_pending_chunks_count() const noexcept {
+    return pending_chunks.size();
+}
+
 void Link::set_busy() noexcept {
     // set busy to true
     busy = true;
@@ -88,6 +176,71 @@ void Link::set_free() noexcept {
     busy = false;
 }
 
+const LinkTelemetry& Link::get_telemetry() const noexcept {
+    return telemetry;
+}
+
+void Link::set_bandwidth(const Bandwidth new_bandwidth) noexcept {
+    assert(new_bandwidth > 0);
+
+    // convert bandwidth from GB/s to B/ns
+    bandwidth = new_bandwidth;
+    bandwidth_Bpns = bw_GBps_to_Bpns(bandwidth);
+}
+
+void Link::set_latency(const Latency new_latency) noexcept {
+    assert(new_latency >= 0);
+
+    latency = new_latency;
+}
+
+bool Link::buffer_available(const Chunk& chunk) const noexcept {
+    // unbounded buffers, or no buffering at the destination
+    if (Link::buffer_size == 0 || chunk.next_device_is_dest()) {
+        return true;
+    }
+
+    // an empty buffer admits any chunk, so chunks larger than the buffer still make progress
+    return buffer_occupancy == 0 || buffer_occupancy + chunk.get_size() <= Link::buffer_size;
+}
+
+void Link::release_buffer(const ChunkSize chunk_size) noexcept {
+    assert(buffer_occupancy >= chunk_size);
+
+    buffer_occupancy -= chunk_size;
+
+    // the first pending chunk may fit now
+    if (!busy && pending_chunk_exists() && buffer_available(*pending_chunks.front())) {
+        process_pending_transmission();
+    }
+}
+
+void Link::schedule_link_free() noexcept {
+    assert(busy);
+    assert(!free_event_scheduled);
+
+    // schedule link free time, ordered as if it was scheduled along with the transmission
+    free_event_scheduled = true;
+    auto* const link_ptr = static_cast<void*>(this);
+    Link::event_queue->schedule_event(busy_until, link_become_free, link_ptr, free_event_sequence);
+}
+
+bool Link::serialization_finished() const noexcept {
+    // at busy_until, the link is free only after the (skipped) link_become_free event would have been invoked
+    const auto current_time = Link::event_queue->get_current_time();
+    if (current_time != busy_until) {
+        return current_time > busy_until;
+    }
+    return Link::event_queue->get_current_sequence() > free_event_sequence;
+}
+
+void Link::update_queueing_delay() noexcept {
+    // every pending chunk waited since the last change
+    const auto current_time = Link::event_queue->get_current_time();
+    telemetry.queueing_delay += pending_chunks.size() * (current_time - pending_chunks_updated_time);
+    pending_chunks_updated_time = current_time;
+}
+
 EventTime Link::serialization_delay(const ChunkSize chunk_size) const noexcept {
     assert(chunk_size > 0);
 
@@ -121,15 +274,37 @@ void Link::schedule_chunk_transmission(std::unique_ptr<Chunk> chunk) noexcept {
     const auto chunk_size = chunk->get_size();
     const auto current_time = Link::event_queue->get_current_time();
 
+    // move the chunk from the buffer of this device to the one of the next device
+    if (Link::buffer_size > 0) {
+        serializing_chunk_buffering_link = chunk->get_buffering_link();
+        serializing_chunk_size = chunk_size;
+        if (chunk->next_device_is_dest()) {
+            chunk->set_buffering_link(nullptr);
+        } else {
+            buffer_occupancy += chunk_size;
+            chunk->set_buffering_link(this);
+        }
+    }
+
     // schedule chunk arrival event
     const auto communication_time = communication_delay(chunk_size);
     const auto chunk_arrival_time = current_time + communication_time;
     auto* const chunk_ptr = static_cast<void*>(chunk.release());
     Link::event_queue->schedule_event(chunk_arrival_time, Chunk::chunk_arrived_next_device, chunk_ptr);
 
-    // schedule link free time
+    // link becomes free after the serialization,
+    // which needs an event only to serve pending chunks or to free the buffer space of the chunk
     const auto serialization_time = serialization_delay(chunk_size);
-    const auto link_free_time = current_time + serialization_time;
-    auto* const link_ptr = static_cast<void*>(this);
-    Link::event_queue->schedule_event(link_free_time, link_become_free, link_ptr);
+    busy_until = current_time + serialization_time;
+    free_event_sequence = Link::event_queue->reserve_sequence();
+    if (pending_chunk_exists() || Link::buffer_size > 0) {
+        schedule_link_free();
+    }
+
+    // account the transmission
+    if (Link::telemetry_enabled) {
+        telemetry.bytes_sent += chunk_size;
+        telemetry.chunks_sent++;
+        telemetry.busy_time += serialization_time;
+    }
 }
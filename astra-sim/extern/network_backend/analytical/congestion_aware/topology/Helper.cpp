@@ -7,6 +7,7 @@ LICENSE file in the root directory of this source tree.
 #include "congestion_aware/BinaryTree.h"
 #include "congestion_aware/DoubleBinaryTree.h"
 #include "congestion_aware/FullyConnected.h"
+#include "congestion_aware/GraphTopology.h"
 #include "congestion_aware/Mesh.h"
 #include "congestion_aware/MultiDimTopology.h"
 #include "congestion_aware/Ring.h"
@@ -17,8 +18,23 @@ LICENSE file in the root directory of this source tree.
 using namespace NetworkAnalytical;
 using namespace NetworkAnalyticalCongestionAware;
 
-std::shared_ptr<Topology> NetworkAnalyticalCongestionAware::construct_topology(
-    const NetworkParser& network_parser) noexcept {
+namespace {
+
+/**
+ * Construct the devices and links of the topology from a NetworkParser.
+ *
+ * @param network_parser NetworkParser to parse the network input file
+ * @return pointer to the constructed topology
+ */
+std::shared_ptr<Topology> construct_topology_shape(const NetworkParser& network_parser) noexcept {
+    // if given as a graph, create graph topology
+    if (network_parser.is_graph()) {
+        return std::make_shared<GraphTopology>(
+            network_parser.get_graph_npus_count(), network_parser.get_graph_switches_count(),
+            network_parser.get_graph_links(), network_parser.get_npus_counts_per_dim(),
+            network_parser.get_bandwidths_per_dim());
+    }
+
     // get network_parser info
     const auto dims_count = network_parser.get_dims_count();
     const auto topologies_per_dim = network_parser.get_topologies_per_dim();
@@ -107,6 +123,36 @@ std::shared_ptr<Topology> NetworkAnalyticalCongestionAware::construct_topology(
     }
 }
 
+}  // namespace
+
+std::shared_ptr<Topology> NetworkAnalyticalCongestionAware::construct_topology(
+    const NetworkParser& network_parser) noexcept {
+    // links already model the contention of concurrent transfers here
+    if (network_parser.get_contention_window() > 0) {
+        std::cerr << "[Error] (network/analytical/congestion_aware) "
+                  << "contention windows are only supported by the congestion unaware backend" << std::endl;
+        std::exit(-1);
+    }
+
+    auto topology = construct_topology_shape(network_parser);
+
+    // set how chunks are spread over equal-cost routes
+    topology->set_routing_policy(network_parser.get_routing_policy());
+
+    // apply per-link overrides on top of the uniform links
+    for (const auto& link_override : network_parser.get_link_overrides()) {
+        topology->override_link(link_override);
+    }
+
+    // finite buffers, if given
+    Topology::set_link_buffer_size(network_parser.get_link_buffer_size());
+
+    // links only collect telemetry if it is written out
+    Topology::set_link_telemetry_enabled(!network_parser.get_link_telemetry_path().empty());
+
+    return topology;
+}
+
 std::vector<std::pair<MultiDimAddress, MultiDimAddress>> NetworkAnalyticalCongestionAware::generateAddressPairs(
     const MultiDimAddress& upper, const ConnectionPolicy& policy, int dim) noexcept {
     std::vector<std::pair<MultiDimAddress, MultiDimAddress>> result;
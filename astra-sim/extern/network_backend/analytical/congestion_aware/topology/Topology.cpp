@@ -6,6 +6,9 @@ LICENSE file in the root directory of this source tree.
 #include "congestion_aware/Topology.h"
 #include "congestion_aware/Link.h"
 #include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
 
 using namespace NetworkAnalyticalCongestionAware;
 
@@ -16,7 +19,21 @@ void Topology::set_event_queue(std::shared_ptr<EventQueue> event_queue) noexcept
     Link::set_event_queue(std::move(event_queue));
 }
 
-Topology::Topology() noexcept : npus_count(-1), devices_count(-1), dims_count(-1) {
+void Topology::set_link_telemetry_enabled(const bool enabled) noexcept {
+    // links keep the counters
+    Link::set_telemetry_enabled(enabled);
+}
+
+void Topology::set_link_buffer_size(const ChunkSize buffer_size) noexcept {
+    // links reserve the buffers of their downstream devices
+    Link::set_buffer_size(buffer_size);
+}
+
+Topology::Topology() noexcept
+    : npus_count(-1),
+      devices_count(-1),
+      dims_count(-1),
+      routing_policy(RoutingPolicy::Deterministic) {
     npus_count_per_dim = {};
 }
 
@@ -54,6 +71,107 @@ std::vector<Bandwidth> Topology::get_bandwidth_per_dim() const noexcept {
     return bandwidth_per_dim;
 }
 
+void Topology::dump_link_telemetry(std::ostream& out, const EventTime end_time) const noexcept {
+    out << "src,dest,bytes,chunks,busy_ns,utilization,max_queue,queueing_delay_ns" << std::endl;
+    for (const auto& device : devices) {
+        for (const auto& [dest, link] : device->get_links()) {
+            // idle links are omitted
+            const auto& telemetry = link->get_telemetry();
+            if (telemetry.chunks_sent == 0) {
+                continue;
+            }
+
+            const auto utilization =
+                end_time > 0 ? static_cast<double>(telemetry.busy_time) / static_cast<double>(end_time) : 0.0;
+            out << device->get_id() << "," << dest << "," << telemetry.bytes_sent << "," << telemetry.chunks_sent << ","
+                << telemetry.busy_time << "," << utilization << "," << telemetry.max_pending_chunks << ","
+                << telemetry.queueing_delay << std::endl;
+        }
+    }
+}
+
+void Topology::override_link(const LinkOverride& link_override) noexcept {
+    // override src -> dest, and dest -> src if bidirectional
+    auto directions = std::vector<std::pair<DeviceId, DeviceId>>({{link_override.src, link_override.dest}});
+    if (link_override.bidirectional) {
+        directions.emplace_back(link_override.dest, link_override.src);
+    }
+
+    for (const auto& [src, dest] : directions) {
+        // find the link
+        auto link = std::shared_ptr<Link>();
+        if (src < devices_count) {
+            const auto& links = devices.at(src)->get_links();
+            if (const auto it = links.find(dest); it != links.end()) {
+                link = it->second;
+            }
+        }
+        if (link == nullptr) {
+            std::cerr << "[Error] (network/analytical/congestion_aware) " << "can't override link (" << src << " -> "
+                      << dest << "), which doesn't exist" << std::endl;
+            std::exit(-1);
+        }
+
+        if (link_override.bandwidth.has_value()) {
+            link->set_bandwidth(link_override.bandwidth.value());
+        }
+        if (link_override.latency.has_value()) {
+            link->set_latency(link_override.latency.value());
+        }
+    }
+}
+
+uint64_t Topology::get_pending_chunks_count() const noexcept {
+    auto pending_chunks_count = uint64_t(0);
+    for (const auto& device : devices) {
+        for (const auto& [dest, link] : device->get_links()) {
+            pending_chunks_count += link->get_pending_chunks_count();
+        }
+    }
+    return pending_chunks_count;
+}
+
+Route Topology::route_with_hash(const DeviceId src, const DeviceId dest, const uint64_t hash) const noexcept {
+    // single route by default
+    return route(src, dest);
+}
+
+int Topology::get_hops_count(const DeviceId src, const DeviceId dest) const noexcept {
+    // a route includes both src and dest
+    return static_cast<int>(route(src, dest).size()) - 1;
+}
+
+Route Topology::route_chunk(const DeviceId src,
+                            const DeviceId dest,
+                            const uint64_t flow_id,
+                            const uint64_t chunk_id) const noexcept {
+    switch (routing_policy) {
+    case RoutingPolicy::Deterministic:
+        return route(src, dest);
+    case RoutingPolicy::Ecmp:
+        // every chunk of the flow takes the same route
+        return route_with_hash(src, dest, mix_hash(mix_hash(mix_hash(0, src), dest), flow_id));
+    case RoutingPolicy::Spray:
+        return route_with_hash(src, dest, mix_hash(mix_hash(mix_hash(mix_hash(0, src), dest), flow_id), chunk_id));
+    default:
+        // shouldn't reach here
+        std::cerr << "[Error] (network/analytical/congestion_aware) " << "not supported routing policy" << std::endl;
+        std::exit(-1);
+    }
+}
+
+void Topology::set_routing_policy(const RoutingPolicy routing_policy) noexcept {
+    this->routing_policy = routing_policy;
+}
+
+uint64_t Topology::mix_hash(const uint64_t hash, const uint64_t value) noexcept {
+    // splitmix64 finalizer over the combined value
+    auto mixed = hash ^ (value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2));
+    mixed = (mixed ^ (mixed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    mixed = (mixed ^ (mixed >> 27)) * 0x94d049bb133111ebULL;
+    return mixed ^ (mixed >> 31);
+}
+
 void Topology::send(std::unique_ptr<Chunk> chunk) noexcept {
     assert(chunk != nullptr);
 
@@ -67,6 +185,47 @@ void Topology::send(std::unique_ptr<Chunk> chunk) noexcept {
     devices.at(src)->send(std::move(chunk));
 }
 
+void Topology::send(const DeviceId src,
+                    const DeviceId dest,
+                    const ChunkSize chunk_size,
+                    const Callback callback,
+                    const CallbackArg callback_arg,
+                    const uint64_t flow_id,
+                    const uint64_t chunk_id) noexcept {
+    assert(0 <= src && src < npus_count);
+    assert(0 <= dest && dest < npus_count);
+
+    // a single hop over a free link needs no chunk object
+    if (routing_policy == RoutingPolicy::Deterministic) {
+        auto* const link = get_single_hop_link(src, dest);
+        if (link != nullptr && link->try_send_single_hop(chunk_size, callback, callback_arg)) {
+            return;
+        }
+    }
+
+    // otherwise, the chunk follows its route
+    auto chunk = std::make_unique<Chunk>(chunk_size, route_chunk(src, dest, flow_id, chunk_id), callback, callback_arg);
+    send(std::move(chunk));
+}
+
+Link* Topology::get_single_hop_link(const DeviceId src, const DeviceId dest) noexcept {
+    const auto key = (static_cast<uint64_t>(src) << 32) | static_cast<uint32_t>(dest);
+
+    // look up the cached link
+    if (const auto it = single_hop_links.find(key); it != single_hop_links.end()) {
+        return it->second;
+    }
+
+    // cache the link if the route is [src, dest]
+    auto* link = static_cast<Link*>(nullptr);
+    const auto route = this->route(src, dest);
+    if (route.size() == 2) {
+        link = route.front()->get_links().at(route.back()->get_id()).get();
+    }
+    single_hop_links.emplace(key, link);
+    return link;
+}
+
 void Topology::connect(const DeviceId src,
                        const DeviceId dest,
                        const Bandwidth bandwidth,
@@ -45,6 +45,24 @@ EventTime BasicTopology::send(const DeviceId src, const DeviceId dest, const Chu
     return compute_communication_delay(hops_count, chunk_size);
 }
 
+int BasicTopology::get_hops_count(const DeviceId src, const DeviceId dest) const noexcept {
+    assert(0 <= src && src < npus_count);
+    assert(0 <= dest && dest < npus_count);
+
+    if (src == dest) {
+        return 0;
+    }
+    return compute_hops_count(src, dest);
+}
+
+int BasicTopology::get_transfer_dim(const DeviceId src, const DeviceId dest) const noexcept {
+    assert(0 <= src && src < npus_count);
+    assert(0 <= dest && dest < npus_count);
+
+    // basic topology has a single dimension
+    return 0;
+}
+
 EventTime BasicTopology::compute_communication_delay(const int hops_count, const ChunkSize chunk_size) const noexcept {
     assert(hops_count > 0);
     assert(chunk_size > 0);
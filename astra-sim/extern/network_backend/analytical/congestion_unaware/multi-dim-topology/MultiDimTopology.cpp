@@ -41,6 +41,23 @@ EventTime MultiDimTopology::send(const DeviceId src, const DeviceId dest, const
     return comms_delay;
 }
 
+int MultiDimTopology::get_hops_count(const DeviceId src, const DeviceId dest) const noexcept {
+    // translate src and dest to multi-dim address
+    const auto src_address = translate_address(src);
+    const auto dest_address = translate_address(dest);
+
+    // the route crosses each dimension the addresses differ in
+    auto hops_count = 0;
+    for (auto dim = 0; dim < dims_count; dim++) {
+        hops_count += topology_per_dim[dim]->get_hops_count(src_address[dim], dest_address[dim]);
+    }
+    return hops_count;
+}
+
+int MultiDimTopology::get_transfer_dim(const DeviceId src, const DeviceId dest) const noexcept {
+    return get_dim_to_transfer(translate_address(src), translate_address(dest));
+}
+
 void MultiDimTopology::append_dimension(std::unique_ptr<BasicTopology> topology) noexcept {
     // increment dims_count
     dims_count++;
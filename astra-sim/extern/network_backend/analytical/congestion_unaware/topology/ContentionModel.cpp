@@ -0,0 +1,123 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#include "congestion_unaware/ContentionModel.h"
+#include "common/NetworkFunction.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+using namespace NetworkAnalytical;
+using namespace NetworkAnalyticalCongestionUnaware;
+
+ContentionModel::ContentionModel(const int npus_count,
+                                 const std::vector<Bandwidth>& bandwidth_per_dim,
+                                 const EventTime window) noexcept
+    : dims_count(static_cast<int>(bandwidth_per_dim.size())),
+      window(window) {
+    assert(npus_count > 0);
+    assert(dims_count > 0);
+    assert(window > 0);
+
+    // translate bandwidth from GB/s to B/ns
+    for (const auto bandwidth : bandwidth_per_dim) {
+        bandwidth_Bpns_per_dim.push_back(bw_GBps_to_Bpns(bandwidth));
+    }
+
+    // create empty ports
+    egress_ports.resize(npus_count * dims_count);
+    ingress_ports.resize(npus_count * dims_count);
+}
+
+EventTime ContentionModel::book_transfer(const DeviceId src,
+                                         const DeviceId dest,
+                                         const int dim,
+                                         const ChunkSize chunk_size,
+                                         const EventTime send_time) noexcept {
+    assert(0 <= src && src * dims_count < static_cast<int>(egress_ports.size()));
+    assert(0 <= dest && dest * dims_count < static_cast<int>(ingress_ports.size()));
+    assert(0 <= dim && dim < dims_count);
+    assert(chunk_size > 0);
+
+    auto& egress_port = egress_ports[src * dims_count + dim];
+    auto& ingress_port = ingress_ports[dest * dims_count + dim];
+
+    // windows before the current one can't overlap with this or any later transfer
+    const auto current_window = send_time / window;
+    drop_windows_before(egress_port, current_window);
+    drop_windows_before(ingress_port, current_window);
+
+    // the more loaded port bounds the transfer
+    const auto bandwidth_Bpns = bandwidth_Bpns_per_dim[dim];
+    const auto start = static_cast<double>(send_time);
+    const auto serialization_end = start + (static_cast<double>(chunk_size) / bandwidth_Bpns);
+    const auto concurrent_load =
+        std::max(get_load(egress_port, start, serialization_end), get_load(ingress_port, start, serialization_end));
+
+    // the bandwidth is shared with the concurrent load
+    const auto contention_delay = concurrent_load / bandwidth_Bpns;
+    const auto end = serialization_end + contention_delay;
+    add_load(egress_port, start, end, static_cast<double>(chunk_size));
+    add_load(ingress_port, start, end, static_cast<double>(chunk_size));
+
+    return static_cast<EventTime>(contention_delay);
+}
+
+void ContentionModel::drop_windows_before(PortLoad& port, const EventTime current_window) noexcept {
+    while (!port.bytes_per_window.empty() && port.first_window < current_window) {
+        port.bytes_per_window.pop_front();
+        port.first_window++;
+    }
+
+    // an idle port starts tracking from the current window
+    if (port.bytes_per_window.empty()) {
+        port.first_window = current_window;
+    }
+}
+
+double ContentionModel::get_load(const PortLoad& port, const double start, const double end) const noexcept {
+    assert(start <= end);
+
+    const auto window_length = static_cast<double>(window);
+    const auto last_window = port.first_window + port.bytes_per_window.size();
+
+    auto load = 0.0;
+    for (auto w = std::max(static_cast<EventTime>(start / window_length), port.first_window); w < last_window; w++) {
+        // overlap of the interval with the window
+        const auto window_start = static_cast<double>(w) * window_length;
+        if (window_start >= end) {
+            break;
+        }
+        const auto overlap = std::min(end, window_start + window_length) - std::max(start, window_start);
+
+        load += port.bytes_per_window[w - port.first_window] * overlap / window_length;
+    }
+
+    return load;
+}
+
+void ContentionModel::add_load(PortLoad& port,
+                               const double start,
+                               const double end,
+                               const double bytes) const noexcept {
+    assert(start < end);
+
+    const auto window_length = static_cast<double>(window);
+    const auto duration = end - start;
+    const auto last_window = static_cast<EventTime>(std::ceil(end / window_length));
+
+    // extend the tracked windows to cover the interval
+    if (port.first_window + port.bytes_per_window.size() < last_window) {
+        port.bytes_per_window.resize(last_window - port.first_window, 0.0);
+    }
+
+    for (auto w = std::max(static_cast<EventTime>(start / window_length), port.first_window); w < last_window; w++) {
+        // overlap of the interval with the window
+        const auto window_start = static_cast<double>(w) * window_length;
+        const auto overlap = std::min(end, window_start + window_length) - std::max(start, window_start);
+
+        port.bytes_per_window[w - port.first_window] += bytes * overlap / duration;
+    }
+}
@@ -17,8 +17,15 @@ LICENSE file in the root directory of this source tree.
 using namespace NetworkAnalytical;
 using namespace NetworkAnalyticalCongestionUnaware;
 
-std::shared_ptr<Topology> NetworkAnalyticalCongestionUnaware::construct_topology(
-    const NetworkParser& network_parser) noexcept {
+namespace {
+
+/**
+ * Construct the basic or multi-dimensional topology from a NetworkParser.
+ *
+ * @param network_parser NetworkParser to parse the network input file
+ * @return pointer to the constructed topology
+ */
+std::shared_ptr<Topology> construct_topology_shape(const NetworkParser& network_parser) noexcept {
     // get network_parser info
     const auto dims_count = network_parser.get_dims_count();
     const auto topologies_per_dim = network_parser.get_topologies_per_dim();
@@ -96,3 +103,39 @@ std::shared_ptr<Topology> NetworkAnalyticalCongestionUnaware::construct_topology
     // return created multi-dimensional topology
     return multi_dim_topology;
 }
+
+}  // namespace
+
+std::shared_ptr<Topology> NetworkAnalyticalCongestionUnaware::construct_topology(
+    const NetworkParser& network_parser) noexcept {
+    // delays are computed per dimension here, which a graph doesn't have
+    if (network_parser.is_graph()) {
+        std::cerr << "[Error] (network/analytical/congestion_unaware) "
+                  << "graph topologies are only supported by the congestion aware backend" << std::endl;
+        std::exit(-1);
+    }
+
+    // links aren't modeled individually here
+    if (!network_parser.get_link_overrides().empty()) {
+        std::cerr << "[Error] (network/analytical/congestion_unaware) "
+                  << "link overrides are only supported by the congestion aware backend" << std::endl;
+        std::exit(-1);
+    }
+
+    // without links, there are no buffers to fill up
+    if (network_parser.get_link_buffer_size() > 0) {
+        std::cerr << "[Error] (network/analytical/congestion_unaware) "
+                  << "finite link buffers are only supported by the congestion aware backend" << std::endl;
+        std::exit(-1);
+    }
+
+    auto topology = construct_topology_shape(network_parser);
+
+    // concurrent transfers slow each other down, if given
+    const auto contention_window = network_parser.get_contention_window();
+    if (contention_window > 0) {
+        topology->enable_contention_model(contention_window);
+    }
+
+    return topology;
+}
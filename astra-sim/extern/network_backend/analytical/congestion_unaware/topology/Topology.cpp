@@ -9,7 +9,32 @@ LICENSE file in the root directory of this source tree.
 using namespace NetworkAnalytical;
 using namespace NetworkAnalyticalCongestionUnaware;
 
-Topology::Topology() noexcept : npus_count(-1), dims_count(-1) {}
+Topology::Topology() noexcept : npus_count(-1), dims_count(-1), contention_model(nullptr) {}
+
+EventTime Topology::send_at(const DeviceId src,
+                            const DeviceId dest,
+                            const ChunkSize chunk_size,
+                            const EventTime send_time) noexcept {
+    // closed-form delay of an isolated transfer
+    const auto comms_delay = send(src, dest, chunk_size);
+    if (contention_model == nullptr) {
+        return comms_delay;
+    }
+
+    // stretch the transfer by the load it shares its ports with
+    const auto dim = get_transfer_dim(src, dest);
+    return comms_delay + contention_model->book_transfer(src, dest, dim, chunk_size, send_time);
+}
+
+void Topology::enable_contention_model(const EventTime window) noexcept {
+    assert(window > 0);
+
+    contention_model = std::make_unique<ContentionModel>(get_npus_count(), get_bandwidth_per_dim(), window);
+}
+
+bool Topology::is_contention_modeled() const noexcept {
+    return contention_model != nullptr;
+}
 
 int Topology::get_npus_count() const noexcept {
     assert(npus_count > 0);
@@ -20,8 +20,9 @@ class Event {
      *
      * @param callback function pointer
      * @param callback_arg argument of the callback function
+     * @param sequence order in which the event was scheduled, if held by an EventQueue
      */
-    Event(Callback callback, CallbackArg callback_arg) noexcept;
+    Event(Callback callback, CallbackArg callback_arg, EventSequence sequence = 0) noexcept;
 
     /**
      * Invoke the callback function.
@@ -35,12 +36,22 @@ class Event {
      */
     [[nodiscard]] std::pair<Callback, CallbackArg> get_handler_arg() const noexcept;
 
+    /**
+     * Get the order in which the event was scheduled.
+     *
+     * @return sequence of the event
+     */
+    [[nodiscard]] EventSequence get_sequence() const noexcept;
+
   private:
     /// pointer to the callback function
     Callback callback;
 
     /// argument of the callback function
     CallbackArg callback_arg;
+
+    /// order in which the event was scheduled
+    EventSequence sequence;
 };
 
 }  // namespace NetworkAnalytical
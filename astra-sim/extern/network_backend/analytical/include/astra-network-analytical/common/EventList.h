@@ -32,16 +32,20 @@ class EventList {
 
     /**
      * Register an event into the event list.
+     * Events are kept (and invoked) in the order of their sequence.
      *
      * @param callback callback function pointer
      * @param callback_arg argument of the callback function
+     * @param sequence order in which the event was scheduled
      */
-    void add_event(Callback callback, CallbackArg callback_arg) noexcept;
+    void add_event(Callback callback, CallbackArg callback_arg, EventSequence sequence) noexcept;
 
     /**
      * Invoke all events in the event list.
+     *
+     * @param current_sequence updated to the sequence of each event before it is invoked
      */
-    void invoke_events() noexcept;
+    void invoke_events(EventSequence& current_sequence) noexcept;
 
   private:
     /// event time of the event list
@@ -52,10 +52,46 @@ class EventQueue {
      */
     void schedule_event(EventTime event_time, Callback callback, CallbackArg callback_arg) noexcept;
 
+    /**
+     * Reserve the sequence of an event that may be scheduled later,
+     * which is then invoked as if it had been scheduled now.
+     *
+     * @return reserved sequence
+     */
+    [[nodiscard]] EventSequence reserve_sequence() noexcept;
+
+    /**
+     * Schedule an event with a given event time and a previously reserved sequence.
+     *
+     * @param event_time time of event
+     * @param callback callback function pointer
+     * @param callback_arg argument of the callback function
+     * @param sequence sequence reserved by reserve_sequence()
+     */
+    void schedule_event(EventTime event_time,
+                        Callback callback,
+                        CallbackArg callback_arg,
+                        EventSequence sequence) noexcept;
+
+    /**
+     * Get the sequence of the event being invoked,
+     * which is 0 before the first event is invoked.
+     * An event with a larger sequence at the current time is yet to be invoked.
+     *
+     * @return sequence of the current event
+     */
+    [[nodiscard]] EventSequence get_current_sequence() const noexcept;
+
   private:
     /// current time of the event queue
     EventTime current_time;
 
+    /// sequence of the event being invoked
+    EventSequence current_sequence;
+
+    /// sequence given to the next scheduled event
+    EventSequence next_sequence;
+
     /// list of EventLists
     std::list<EventList> event_queue;
 };
@@ -60,6 +60,78 @@ class NetworkParser {
      */
     [[nodiscard]] std::vector<TopologyBuildingBlock> get_topologies_per_dim() const noexcept;
 
+    /**
+     * Read "routing" value, which is "deterministic" if not given
+     *
+     * @return routing policy of the network
+     */
+    [[nodiscard]] RoutingPolicy get_routing_policy() const noexcept;
+
+    /**
+     * Read "link_telemetry" value, the file the per-link counters are written to
+     * at the end of the simulation. Link telemetry is disabled if not given.
+     *
+     * @return path of the link telemetry file, empty if disabled
+     */
+    [[nodiscard]] std::string get_link_telemetry_path() const noexcept;
+
+    /**
+     * Read "link_overrides" value, which is empty if not given.
+     * Each override replaces the bandwidth and/or latency of an existing link,
+     * e.g., to model a degraded link or slower switch uplinks within a dimension.
+     *
+     * @return per-link overrides of the network
+     */
+    [[nodiscard]] std::vector<LinkOverride> get_link_overrides() const noexcept;
+
+    /**
+     * Read "link_buffer_size" value, the buffer size in bytes at the receiving end of every link.
+     * Links have unbounded buffers if not given.
+     *
+     * @return buffer size of every link in bytes, 0 if unbounded
+     */
+    [[nodiscard]] ChunkSize get_link_buffer_size() const noexcept;
+
+    /**
+     * Read "contention_window" value, the length in ns of the time windows over which
+     * the congestion unaware backend accumulates the load of concurrent transfers.
+     * Concurrent transfers don't interact if not given.
+     *
+     * @return length of a contention window in ns, 0 if disabled
+     */
+    [[nodiscard]] EventTime get_contention_window() const noexcept;
+
+    /**
+     * Check whether the file describes the network as a graph
+     * (i.e., has a "graph" value) instead of per-dimension building blocks.
+     * The per-dimension values of a graph only describe how the NPUs are
+     * grouped into dimensions, and "topology" is not available.
+     *
+     * @return true if the network is a graph, false otherwise
+     */
+    [[nodiscard]] bool is_graph() const noexcept;
+
+    /**
+     * Read "graph.npus_count" value
+     *
+     * @return number of NPUs of the graph
+     */
+    [[nodiscard]] int get_graph_npus_count() const noexcept;
+
+    /**
+     * Read "graph.switches_count" value
+     *
+     * @return number of switches of the graph
+     */
+    [[nodiscard]] int get_graph_switches_count() const noexcept;
+
+    /**
+     * Read "graph.links" value
+     *
+     * @return links of the graph
+     */
+    [[nodiscard]] std::vector<GraphLink> get_graph_links() const noexcept;
+
   private:
     /// number of network dimensions
     int dims_count;
@@ -76,6 +148,33 @@ class NetworkParser {
     /// topology building block per each dimension
     std::vector<TopologyBuildingBlock> topology_per_dim;
 
+    /// routing policy of the network
+    RoutingPolicy routing_policy;
+
+    /// file the link telemetry is written to, empty if disabled
+    std::string link_telemetry_path;
+
+    /// per-link bandwidth and latency overrides
+    std::vector<LinkOverride> link_overrides;
+
+    /// buffer size at the receiving end of every link in bytes, 0 if unbounded
+    ChunkSize link_buffer_size;
+
+    /// length of a contention window in ns, 0 if disabled
+    EventTime contention_window;
+
+    /// true if the network is given as a graph
+    bool graph;
+
+    /// number of NPUs of the graph, which are devices 0 to graph_npus_count - 1
+    int graph_npus_count;
+
+    /// number of switches of the graph, which follow the NPUs
+    int graph_switches_count;
+
+    /// links of the graph
+    std::vector<GraphLink> graph_links;
+
     /**
      * Parse topology name (in string) into TopologyBuildingBlock enum
      *
@@ -85,6 +184,15 @@ class NetworkParser {
      */
     [[nodiscard]] static TopologyBuildingBlock parse_topology_name(const std::string& topology_name) noexcept;
 
+    /**
+     * Parse routing policy name (in string) into RoutingPolicy enum
+     *
+     * @param routing_policy_name routing policy name in string
+     *    which can be "deterministic", "ecmp", or "spray"
+     * @return parsed RoutingPolicy enum class value
+     */
+    [[nodiscard]] static RoutingPolicy parse_routing_policy_name(const std::string& routing_policy_name) noexcept;
+
     /**
      * Parse the given YAML node and retrieve network configuration values
      *
@@ -92,6 +200,32 @@ class NetworkParser {
      */
     void parse_network_config_yml(const YAML::Node& network_config) noexcept;
 
+    /**
+     * Parse the "graph" value of the given YAML node, and the per-dimension
+     * values that group its NPUs into dimensions.
+     *
+     * @param network_config opened and parsed YAML node
+     */
+    void parse_graph_config_yml(const YAML::Node& network_config) noexcept;
+
+    /**
+     * Parse the "link_overrides" value of the given YAML node.
+     *
+     * @param network_config opened and parsed YAML node
+     */
+    void parse_link_overrides_yml(const YAML::Node& network_config) noexcept;
+
+    /**
+     * Check the validity of the parsed link overrides.
+     * Whether the overridden links exist is only known once the topology is built.
+     */
+    void check_link_overrides_validity() const noexcept;
+
+    /**
+     * Check the validity of the parsed graph.
+     */
+    void check_graph_validity() const noexcept;
+
     /**
      * Check the validity and correctness of the parsed network input
      * configurations.
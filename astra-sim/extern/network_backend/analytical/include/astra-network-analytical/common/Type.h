@@ -6,6 +6,7 @@ LICENSE file in the root directory of this source tree.
 #pragma once
 
 #include <cstdint>
+#include <optional>
 #include <vector>
 
 namespace NetworkAnalytical {
@@ -31,6 +32,9 @@ using Latency = double;
 /// Event time in ns
 using EventTime = uint64_t;
 
+/// Order in which events were scheduled, which breaks ties between events of the same time
+using EventSequence = uint64_t;
+
 /// Basic multi-dimensional topology building blocks
 enum class TopologyBuildingBlock {
     Undefined,
@@ -43,6 +47,12 @@ enum class TopologyBuildingBlock {
     HyperCube
 };
 
+/// How chunks are spread over the equal-cost routes between two NPUs
+///   - Deterministic: every chunk takes the same route
+///   - Ecmp: every flow takes one route, picked by hashing the flow
+///   - Spray: every chunk takes one route, picked by hashing the flow and the chunk
+enum class RoutingPolicy { Deterministic, Ecmp, Spray };
+
 /// Multi-dimensional address of a device.
 /// Each NPU ID can be broken down into multiple dimensions.
 /// for example, if the topology size is [2, 8, 4] and the NPU ID is 31,
@@ -57,4 +67,22 @@ struct ConnectionPolicy {
     ConnectionPolicy(DeviceId src, DeviceId dst) : src(src), dst(dst){};
 };
 
+/// Link of a graph topology, from src to dest
+struct GraphLink {
+    DeviceId src;
+    DeviceId dest;
+    Bandwidth bandwidth;
+    Latency latency;
+    bool bidirectional;
+};
+
+/// Bandwidth and/or latency that replace those of an existing link from src to dest
+struct LinkOverride {
+    DeviceId src;
+    DeviceId dest;
+    std::optional<Bandwidth> bandwidth;
+    std::optional<Latency> latency;
+    bool bidirectional;
+};
+
 }  // namespace NetworkAnalytical
@@ -66,6 +66,28 @@ class Chunk {
      */
     [[nodiscard]] bool arrived_dest() const noexcept;
 
+    /**
+     * Check if the next device of the chunk is its destination
+     * i.e., if the route length is 2 (current device and destination left)
+     *
+     * @return true if the next device is the destination, false otherwise
+     */
+    [[nodiscard]] bool next_device_is_dest() const noexcept;
+
+    /**
+     * Get the link whose downstream buffer holds the chunk at its current device.
+     *
+     * @return link holding the chunk in its buffer, nullptr if none
+     */
+    [[nodiscard]] Link* get_buffering_link() const noexcept;
+
+    /**
+     * Set the link whose downstream buffer holds the chunk at its next device.
+     *
+     * @param link link holding the chunk in its buffer, nullptr if none
+     */
+    void set_buffering_link(Link* link) noexcept;
+
     /**
      * Get the size of the chunk
      *
@@ -94,6 +116,10 @@ class Chunk {
 
     /// argument of the callback
     CallbackArg callback_arg;
+
+    /// link that reserved buffer space for the chunk at its current device,
+    /// only set while links have finite buffers
+    Link* buffering_link;
 };
 
 }  // namespace NetworkAnalyticalCongestionAware
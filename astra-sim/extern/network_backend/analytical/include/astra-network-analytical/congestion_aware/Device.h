@@ -51,6 +51,13 @@ class Device {
      */
     void connect(DeviceId id, Bandwidth bandwidth, Latency latency) noexcept;
 
+    /**
+     * Get the outgoing links of the device.
+     *
+     * @return map[dest device id] -> link
+     */
+    [[nodiscard]] const std::map<DeviceId, std::shared_ptr<Link>>& get_links() const noexcept;
+
   private:
     /// device Id
     DeviceId device_id;
@@ -0,0 +1,84 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#pragma once
+
+#include "common/Type.h"
+#include "congestion_aware/Topology.h"
+#include <vector>
+
+using namespace NetworkAnalytical;
+
+namespace NetworkAnalyticalCongestionAware {
+
+/**
+ * Implements an arbitrary topology given as a graph of NPUs, switches,
+ * and the links between them, e.g., fat trees or dragonflies.
+ *
+ * NPUs are devices 0 to (npus_count - 1), and switches follow them.
+ * A chunk follows a shortest path to its destination,
+ * i.e., a path with the fewest hops, then the lowest latency.
+ * route() breaks ties by taking the next device with the lowest id,
+ * while route_with_hash() picks one of the equal-cost next devices
+ * at every hop by the hash.
+ * The next devices towards each NPU are computed once, on construction.
+ *
+ * e.g., with NPUs 0-3 and switches 4-6, where 4 connects NPUs 0 and 1,
+ * 5 connects NPUs 2 and 3, and 6 connects switches 4 and 5,
+ * send(0 -> 3) flows through 0 -> 4 -> 6 -> 5 -> 3.
+ */
+class GraphTopology final : public Topology {
+  public:
+    /**
+     * Constructor.
+     *
+     * @param npus_count number of NPUs in the graph
+     * @param switches_count number of switches in the graph
+     * @param links links between the devices
+     * @param npus_count_per_dim number of NPUs per each dimension the NPUs are grouped into
+     * @param bandwidth_per_dim bandwidth per each dimension the NPUs are grouped into
+     */
+    GraphTopology(int npus_count,
+                  int switches_count,
+                  const std::vector<GraphLink>& links,
+                  const std::vector<int>& npus_count_per_dim,
+                  const std::vector<Bandwidth>& bandwidth_per_dim) noexcept;
+
+    /**
+     * Implementation of route function in Topology.
+     */
+    [[nodiscard]] Route route(DeviceId src, DeviceId dest) const noexcept override;
+
+    /**
+     * Implementation of route_with_hash function in Topology.
+     */
+    [[nodiscard]] Route route_with_hash(DeviceId src, DeviceId dest, uint64_t hash) const noexcept override;
+
+    /**
+     * Implementation of get_hops_count function in Topology.
+     * Follows the routing table without constructing the route.
+     */
+    [[nodiscard]] int get_hops_count(DeviceId src, DeviceId dest) const noexcept override;
+
+  private:
+    /// routing tables towards each NPU dest, in compressed form:
+    /// the equal-cost devices a chunk at device may move to next are
+    /// next_hops[dest][next_hops_offset[dest][device]] to
+    /// next_hops[dest][next_hops_offset[dest][device + 1] - 1], in increasing id order
+    std::vector<std::vector<DeviceId>> next_hops;
+
+    /// offsets of each device into next_hops
+    std::vector<std::vector<int>> next_hops_offset;
+
+    /**
+     * Compute the routing tables towards every NPU.
+     * Exits if an NPU can't reach another NPU.
+     *
+     * @param links links between the devices
+     */
+    void build_routing_tables(const std::vector<GraphLink>& links) noexcept;
+};
+
+}  // namespace NetworkAnalyticalCongestionAware
@@ -21,7 +21,8 @@ class Link {
   public:
     /**
      * Callback to be called when a link becomes free.
-     *  - If the link has pending chunks, process the first one.
+     *  - Free the buffer space the serialized chunk held at this device.
+     *  - If the link has pending chunks that fit the downstream buffer, process the first one.
      *  - If the link has no pending chunks, set the link as free.
      *
      * @param link_ptr pointer to the link that becomes free
@@ -35,6 +36,26 @@ class Link {
      */
     static void set_event_queue(std::shared_ptr<EventQueue> event_queue_ptr) noexcept;
 
+    /**
+     * Enable or disable the telemetry counters of all links.
+     * Disabled by default, in which case the links skip the counters altogether.
+     *
+     * @param enabled true to collect the counters
+     */
+    static void set_telemetry_enabled(bool enabled) noexcept;
+
+    /**
+     * Set the buffer size at the receiving end of every link.
+     * A link only starts transmitting a chunk once the buffer of its downstream device
+     * has room for it, and the room is freed once the chunk left that device,
+     * so a congested hop backpressures the links feeding it.
+     * Chunks are never buffered at their destination,
+     * and a chunk larger than the buffer is admitted into an empty buffer.
+     *
+     * @param size buffer size in bytes, 0 for unbounded buffers (the default)
+     */
+    static void set_buffer_size(ChunkSize size) noexcept;
+
     /**
      * Constructor.
      *
@@ -46,12 +67,26 @@ class Link {
     /**
      * Try to send a chunk through the link.
      * - If the link is free, service the chunk immediately.
-     * - If the link is busy, add the chunk to the pending chunks list.
+     * - If the link is busy, or its downstream buffer is full,
+     *   add the chunk to the pending chunks list.
      *
      * @param chunk the chunk to be served by the link
      */
     void send(std::unique_ptr<Chunk> chunk) noexcept;
 
+    /**
+     * Try to send a chunk to the device at the other end of the link without a Chunk object.
+     * Succeeds only if the chunk can be served immediately and nothing needs the chunk later,
+     * i.e., the link is free, has no pending chunks, and telemetry and finite buffers are disabled.
+     * The arrival then invokes the callback directly, with the same timing and event order as send.
+     *
+     * @param chunk_size size of the chunk
+     * @param callback callback to be invoked when the chunk arrives at the other end
+     * @param callback_arg argument of the callback
+     * @return true if the chunk was sent, false if it has to go through send
+     */
+    [[nodiscard]] bool try_send_single_hop(ChunkSize chunk_size, Callback callback, CallbackArg callback_arg) noexcept;
+
     /**
      * Dequeue and try to send the first pending chunk
      * in the pending chunks list.
@@ -65,6 +100,13 @@ class Link {
      */
     [[nodiscard]] bool pending_chunk_exists() const noexcept;
 
+    /**
+     * Get the number of pending chunks.
+     *
+     * @return number of chunks waiting for the link
+     */
+    [[nodiscard]] uint64_t get_pending_chunks_count() const noexcept;
+
     /**
      * Set the link as busy.
      */
@@ -75,10 +117,40 @@ class Link {
      */
     void set_free() noexcept;
 
+    /**
+     * Get the telemetry counters of the link.
+     * Only filled while link telemetry is enabled.
+     *
+     * @return telemetry counters of the link
+     */
+    [[nodiscard]] const LinkTelemetry& get_telemetry() const noexcept;
+
+    /**
+     * Change the bandwidth of the link.
+     * Chunks already being transmitted keep their timing.
+     *
+     * @param new_bandwidth new bandwidth of the link in GB/s
+     */
+    void set_bandwidth(Bandwidth new_bandwidth) noexcept;
+
+    /**
+     * Change the latency of the link.
+     * Chunks already being transmitted keep their timing.
+     *
+     * @param new_latency new latency of the link in ns
+     */
+    void set_latency(Latency new_latency) noexcept;
+
   private:
     /// event queue Link uses to schedule events
     static std::shared_ptr<EventQueue> event_queue;
 
+    /// whether links collect telemetry counters
+    static bool telemetry_enabled;
+
+    /// buffer size at the receiving end of every link in bytes, 0 if unbounded
+    static ChunkSize buffer_size;
+
     /// bandwidth of the link in GB/s
     Bandwidth bandwidth;
 
@@ -94,6 +166,70 @@ class Link {
     /// flag to indicate if the link is busy
     bool busy;
 
+    /// time the serialization of the current chunk finishes
+    EventTime busy_until;
+
+    /// sequence reserved for the link_become_free event at busy_until
+    EventSequence free_event_sequence;
+
+    /// whether a link_become_free event is scheduled at busy_until.
+    /// Without pending chunks or finite buffers, nothing happens when the link becomes free,
+    /// so the event is skipped and the link is found free by the next send instead.
+    /// An uncontended hop then costs a single (arrival) event.
+    bool free_event_scheduled;
+
+    /// telemetry counters of the link
+    LinkTelemetry telemetry;
+
+    /// bytes reserved in the buffer of the downstream device
+    ChunkSize buffer_occupancy;
+
+    /// link whose buffer held the chunk being serialized, nullptr if none,
+    /// released once the serialization finishes
+    Link* serializing_chunk_buffering_link;
+
+    /// size of the chunk being serialized
+    ChunkSize serializing_chunk_size;
+
+    /// last time the number of pending chunks changed,
+    /// used to integrate the queueing delay over the queue length
+    EventTime pending_chunks_updated_time;
+
+    /**
+     * Account the time the pending chunks waited since the queue length last changed.
+     * Must be called right before the queue length changes.
+     */
+    void update_queueing_delay() noexcept;
+
+    /**
+     * Schedule the link_become_free event at the end of the current serialization.
+     */
+    void schedule_link_free() noexcept;
+
+    /**
+     * Check if the serialization of the current chunk finished,
+     * i.e., the link_become_free event would have already been invoked if it was scheduled.
+     *
+     * @return true if the serialization finished, false otherwise
+     */
+    [[nodiscard]] bool serialization_finished() const noexcept;
+
+    /**
+     * Check if the downstream buffer has room for the chunk.
+     *
+     * @param chunk chunk to be transmitted next
+     * @return true if the chunk can be transmitted, false if it should wait
+     */
+    [[nodiscard]] bool buffer_available(const Chunk& chunk) const noexcept;
+
+    /**
+     * Free buffer space a chunk held in the downstream device,
+     * and resume the transmission of the pending chunks if they fit now.
+     *
+     * @param chunk_size size of the chunk that left the downstream device
+     */
+    void release_buffer(ChunkSize chunk_size) noexcept;
+
     /**
      * Compute the serialization delay of a chunk on the link.
      * i.e., serialization delay = (chunk size) / (link bandwidth)
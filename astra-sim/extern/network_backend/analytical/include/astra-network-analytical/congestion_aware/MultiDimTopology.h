@@ -33,6 +33,20 @@ class MultiDimTopology : public Topology {
      */
     [[nodiscard]] Route route(DeviceId src, DeviceId dest) const noexcept override;
 
+    /**
+     * Implementation of route_with_hash function in Topology.
+     * The hash picks the order the dimensions are traversed in,
+     * and the equal-cost route within each dimension.
+     */
+    [[nodiscard]] Route route_with_hash(DeviceId src, DeviceId dest, uint64_t hash) const noexcept override;
+
+    /**
+     * Implementation of get_hops_count function in Topology.
+     * Every route crosses each dimension the addresses differ in once,
+     * so the hops of the dimensions add up.
+     */
+    [[nodiscard]] int get_hops_count(DeviceId src, DeviceId dest) const noexcept override;
+
     /**
      * Add a dimension to the multi-dimensional topology.
      *
@@ -56,6 +70,20 @@ class MultiDimTopology : public Topology {
     void build_switch_length_mapping() noexcept;
 
   private:
+    /**
+     * Construct the route from src to dest, traversing the dimensions in the given order.
+     *
+     * @param src src NPU id
+     * @param dest dest NPU id
+     * @param dims_order dimensions in the order to traverse them
+     * @param hash hash that picks the route within each dimension, if any
+     * @return route from src NPU to dest NPU
+     */
+    [[nodiscard]] Route build_route(DeviceId src,
+                                    DeviceId dest,
+                                    const std::vector<int>& dims_order,
+                                    std::optional<uint64_t> hash) const noexcept;
+
     /**
      * Translate the NPU ID into a multi-dimensional address.
      *
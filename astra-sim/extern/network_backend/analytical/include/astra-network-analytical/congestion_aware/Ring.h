@@ -50,6 +50,13 @@ class Ring final : public BasicTopology {
      */
     [[nodiscard]] Route route(DeviceId src, DeviceId dest) const noexcept override;
 
+    /**
+     * Implementation of route_with_hash function in Topology.
+     * If the ring is bidirectional and dest is exactly halfway around the ring,
+     * the hash picks the direction. Otherwise, the route is the same as route().
+     */
+    [[nodiscard]] Route route_with_hash(DeviceId src, DeviceId dest, uint64_t hash) const noexcept override;
+
     /**
      * Get connection policies of the ring topology.
      * Each connection policy is represented as a pair of (src, dest) device ids.
@@ -63,6 +70,16 @@ class Ring final : public BasicTopology {
   private:
     /// true if the ring is bidirectional, false otherwise
     bool bidirectional;
+
+    /**
+     * Construct the route from src to dest in the given direction.
+     *
+     * @param src src NPU id
+     * @param dest dest NPU id
+     * @param step 1 to traverse the ring clockwise, -1 for anticlockwise
+     * @return route from src NPU to dest NPU
+     */
+    [[nodiscard]] Route route_in_direction(DeviceId src, DeviceId dest, int step) const noexcept;
 };
 
 }  // namespace NetworkAnalyticalCongestionAware
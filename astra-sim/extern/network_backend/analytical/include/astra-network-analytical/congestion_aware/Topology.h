@@ -9,6 +9,8 @@ LICENSE file in the root directory of this source tree.
 #include "congestion_aware/Chunk.h"
 #include "congestion_aware/Device.h"
 #include <memory>
+#include <ostream>
+#include <unordered_map>
 #include <vector>
 
 using namespace NetworkAnalytical;
@@ -27,6 +29,21 @@ class Topology {
      */
     static void set_event_queue(std::shared_ptr<EventQueue> event_queue) noexcept;
 
+    /**
+     * Enable or disable collecting the telemetry counters of every link.
+     *
+     * @param enabled true to collect the counters
+     */
+    static void set_link_telemetry_enabled(bool enabled) noexcept;
+
+    /**
+     * Set the buffer size at the receiving end of every link,
+     * with which congested hops backpressure the links feeding them.
+     *
+     * @param buffer_size buffer size in bytes, 0 for unbounded buffers
+     */
+    static void set_link_buffer_size(ChunkSize buffer_size) noexcept;
+
     /**
      * Constructor.
      */
@@ -46,6 +63,51 @@ class Topology {
      */
     [[nodiscard]] virtual Route route(DeviceId src, DeviceId dest) const noexcept = 0;
 
+    /**
+     * Construct one of the equal-cost routes from src to dest.
+     * The same hash always selects the same route.
+     * Topologies with a single route per (src, dest) pair return route(src, dest).
+     *
+     * @param src src NPU id
+     * @param dest dest NPU id
+     * @param hash hash that selects the route
+     *
+     * @return route from src NPU to dest NPU
+     */
+    [[nodiscard]] virtual Route route_with_hash(DeviceId src, DeviceId dest, uint64_t hash) const noexcept;
+
+    /**
+     * Get the number of hops (links) the route from src to dest crosses.
+     * By default, counts the hops of route(src, dest);
+     * topologies that know their distances override it to skip constructing the route.
+     *
+     * @param src src NPU id
+     * @param dest dest NPU id
+     *
+     * @return number of hops from src NPU to dest NPU
+     */
+    [[nodiscard]] virtual int get_hops_count(DeviceId src, DeviceId dest) const noexcept;
+
+    /**
+     * Construct the route of a chunk from src to dest,
+     * spreading the chunks over the equal-cost routes as the routing policy says.
+     *
+     * @param src src NPU id
+     * @param dest dest NPU id
+     * @param flow_id id of the flow the chunk belongs to, e.g., its tag
+     * @param chunk_id id of the chunk within the flow
+     *
+     * @return route from src NPU to dest NPU
+     */
+    [[nodiscard]] Route route_chunk(DeviceId src, DeviceId dest, uint64_t flow_id, uint64_t chunk_id) const noexcept;
+
+    /**
+     * Set the routing policy used by route_chunk.
+     *
+     * @param routing_policy routing policy
+     */
+    void set_routing_policy(RoutingPolicy routing_policy) noexcept;
+
     /**
      * Initiate a transmission of a chunk.
      *
@@ -53,6 +115,28 @@ class Topology {
      */
     void send(std::unique_ptr<Chunk> chunk) noexcept;
 
+    /**
+     * Initiate a transmission of a chunk from src to dest,
+     * routed as route_chunk says.
+     * A chunk crossing a single free link with deterministic routing skips the Chunk object and its route:
+     * the link invokes the callback on arrival (see Link::try_send_single_hop).
+     *
+     * @param src src NPU id
+     * @param dest dest NPU id
+     * @param chunk_size size of the chunk
+     * @param callback callback to be invoked when the chunk arrives dest
+     * @param callback_arg argument of the callback
+     * @param flow_id id of the flow the chunk belongs to, e.g., its tag
+     * @param chunk_id id of the chunk within the flow
+     */
+    void send(DeviceId src,
+              DeviceId dest,
+              ChunkSize chunk_size,
+              Callback callback,
+              CallbackArg callback_arg,
+              uint64_t flow_id,
+              uint64_t chunk_id) noexcept;
+
     /**
      * Get the number of NPUs in the topology.
      * NPU excludes non-NPU devices such as switches.
@@ -90,6 +174,35 @@ class Topology {
      */
     [[nodiscard]] std::vector<Bandwidth> get_bandwidth_per_dim() const noexcept;
 
+    /**
+     * Write the telemetry counters of every link that transmitted a chunk, as CSV
+     * ordered by the src and dest device of the link.
+     * Utilization is the busy time of the link over the given end time.
+     *
+     * @param out stream to write the counters to
+     * @param end_time time the simulation finished at
+     */
+    void dump_link_telemetry(std::ostream& out, EventTime end_time) const noexcept;
+
+    /**
+     * Replace the bandwidth and/or latency of an existing link,
+     * e.g., to model a degraded link within an otherwise uniform dimension.
+     * NPUs are devices 0 to (npus_count - 1), and switches follow them.
+     * Exits if the devices aren't connected.
+     *
+     * @param link_override link to change and its new bandwidth and/or latency
+     */
+    void override_link(const LinkOverride& link_override) noexcept;
+
+    /**
+     * Count the chunks still waiting for a link.
+     * Once no events are left, these are chunks stuck behind full buffers,
+     * i.e., the buffers of a cycle of links wait for each other.
+     *
+     * @return number of chunks waiting for a link
+     */
+    [[nodiscard]] uint64_t get_pending_chunks_count() const noexcept;
+
   protected:
     /// number of total devices in the topology
     /// device includes non-NPU devices such as switches
@@ -111,6 +224,32 @@ class Topology {
     /// bandwidth per each network dimension
     std::vector<Bandwidth> bandwidth_per_dim;
 
+    /// routing policy used by route_chunk
+    RoutingPolicy routing_policy;
+
+    /// link of each (src, dest) pair whose route is a single hop, nullptr for longer routes,
+    /// filled as the pairs send their first chunk
+    std::unordered_map<uint64_t, Link*> single_hop_links;
+
+    /**
+     * Get the link src -> dest if the route between them is a single hop.
+     *
+     * @param src src NPU id
+     * @param dest dest NPU id
+     * @return link from src to dest, nullptr if the route has more hops
+     */
+    [[nodiscard]] Link* get_single_hop_link(DeviceId src, DeviceId dest) noexcept;
+
+    /**
+     * Mix a value into a hash, so that route_with_hash can derive
+     * independent choices (e.g., per device) from a single hash.
+     *
+     * @param hash hash to mix into
+     * @param value value to be mixed
+     * @return mixed hash
+     */
+    [[nodiscard]] static uint64_t mix_hash(uint64_t hash, uint64_t value) noexcept;
+
     /**
      * Instantiate Device objects in the topology.
      */
@@ -5,9 +5,12 @@ LICENSE file in the root directory of this source tree.
 
 #pragma once
 
+#include "common/Type.h"
 #include <list>
 #include <memory>
 
+using namespace NetworkAnalytical;
+
 namespace NetworkAnalyticalCongestionAware {
 
 /// Forward declarations of network components
@@ -18,4 +21,22 @@ class Device;
 /// Route is a list of devices
 using Route = std::list<std::shared_ptr<Device>>;
 
+/// Counters a link collects while link telemetry is enabled
+struct LinkTelemetry {
+    /// bytes of the chunks the link transmitted
+    ChunkSize bytes_sent = 0;
+
+    /// number of chunks the link transmitted
+    uint64_t chunks_sent = 0;
+
+    /// total time the link spent serializing chunks, in ns
+    EventTime busy_time = 0;
+
+    /// largest number of chunks that waited for the link at once
+    uint64_t max_pending_chunks = 0;
+
+    /// sum of the time every chunk waited for the link, in ns
+    EventTime queueing_delay = 0;
+};
+
 }  // namespace NetworkAnalyticalCongestionAware
@@ -38,6 +38,11 @@ class BasicTopology : public Topology {
      */
     [[nodiscard]] EventTime send(DeviceId src, DeviceId dest, ChunkSize chunk_size) const noexcept override;
 
+    /**
+     * Implement the get_hops_count method of Topology.
+     */
+    [[nodiscard]] int get_hops_count(DeviceId src, DeviceId dest) const noexcept override;
+
     /**
      * Return the type of the basic topology
      * as a TopologyBuildingBlock enum class element.
@@ -56,6 +61,11 @@ class BasicTopology : public Topology {
      */
     [[nodiscard]] virtual int compute_hops_count(DeviceId src, DeviceId dest) const noexcept = 0;
 
+    /**
+     * Implement the get_transfer_dim method of Topology.
+     */
+    [[nodiscard]] int get_transfer_dim(DeviceId src, DeviceId dest) const noexcept override;
+
     /// type of the basic topology
     TopologyBuildingBlock basic_topology_type;
 
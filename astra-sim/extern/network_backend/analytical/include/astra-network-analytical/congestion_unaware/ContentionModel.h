@@ -0,0 +1,110 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+*******************************************************************************/
+
+#pragma once
+
+#include "common/Type.h"
+#include <deque>
+#include <vector>
+
+using namespace NetworkAnalytical;
+
+namespace NetworkAnalyticalCongestionUnaware {
+
+/**
+ * ContentionModel approximates the slowdown of concurrent transfers
+ * without simulating individual links.
+ *
+ * Every NPU has an egress and an ingress port per network dimension,
+ * which accumulate the bytes of the transfers crossing them over fixed-length time windows.
+ * A transfer shares the bandwidth of its ports with the load already booked on them
+ * while it is serialized, so its serialization is stretched by (booked bytes) / bandwidth.
+ * The transfer is then booked evenly over its stretched duration.
+ *
+ * Transfers are expected to be booked in non-decreasing send time,
+ * which lets each port forget the windows that already ended.
+ */
+class ContentionModel {
+  public:
+    /**
+     * Constructor.
+     *
+     * @param npus_count number of NPUs in the topology
+     * @param bandwidth_per_dim bandwidth (GB/s) of each network dimension
+     * @param window length of a contention window in ns
+     */
+    ContentionModel(int npus_count, const std::vector<Bandwidth>& bandwidth_per_dim, EventTime window) noexcept;
+
+    /**
+     * Book a transfer on the ports of src and dest of the given dimension.
+     *
+     * @param src src NPU ID
+     * @param dest dest NPU ID
+     * @param dim dimension the transfer happens in
+     * @param chunk_size size of the chunk
+     * @param send_time time the transfer starts
+     * @return additional delay of the transfer due to the load of concurrent transfers
+     */
+    [[nodiscard]] EventTime book_transfer(
+        DeviceId src, DeviceId dest, int dim, ChunkSize chunk_size, EventTime send_time) noexcept;
+
+  private:
+    /**
+     * Load of a port, as bytes per window starting from first_window.
+     */
+    struct PortLoad {
+        /// index of the first tracked window
+        EventTime first_window = 0;
+
+        /// bytes crossing the port in each tracked window
+        std::deque<double> bytes_per_window;
+    };
+
+    /// number of network dimensions
+    int dims_count;
+
+    /// bandwidth of each dimension in B/ns
+    std::vector<Bandwidth> bandwidth_Bpns_per_dim;
+
+    /// length of a contention window in ns
+    EventTime window;
+
+    /// egress port load of each (NPU, dimension), indexed by npu * dims_count + dim
+    std::vector<PortLoad> egress_ports;
+
+    /// ingress port load of each (NPU, dimension), indexed by npu * dims_count + dim
+    std::vector<PortLoad> ingress_ports;
+
+    /**
+     * Forget the windows of a port before the given window.
+     *
+     * @param port port to update
+     * @param current_window index of the window of the current time
+     */
+    static void drop_windows_before(PortLoad& port, EventTime current_window) noexcept;
+
+    /**
+     * Get the bytes booked on a port during [start, end),
+     * assuming the bytes of a window cross the port evenly over the window.
+     *
+     * @param port port to look up
+     * @param start start of the interval in ns
+     * @param end end of the interval in ns
+     * @return bytes booked during the interval
+     */
+    [[nodiscard]] double get_load(const PortLoad& port, double start, double end) const noexcept;
+
+    /**
+     * Book bytes on a port evenly over [start, end).
+     *
+     * @param port port to update
+     * @param start start of the interval in ns
+     * @param end end of the interval in ns
+     * @param bytes bytes to book
+     */
+    void add_load(PortLoad& port, double start, double end, double bytes) const noexcept;
+};
+
+}  // namespace NetworkAnalyticalCongestionUnaware
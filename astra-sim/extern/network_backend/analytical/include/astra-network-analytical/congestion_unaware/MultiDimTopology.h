@@ -30,6 +30,11 @@ class MultiDimTopology : public Topology {
      */
     [[nodiscard]] EventTime send(DeviceId src, DeviceId dest, ChunkSize chunk_size) const noexcept override;
 
+    /**
+     * Implement the get_hops_count method of Topology.
+     */
+    [[nodiscard]] int get_hops_count(DeviceId src, DeviceId dest) const noexcept override;
+
     /**
      * Add a dimension to the multi-dimensional topology.
      *
@@ -37,6 +42,12 @@ class MultiDimTopology : public Topology {
      */
     void append_dimension(std::unique_ptr<BasicTopology> basic_topology) noexcept;
 
+  protected:
+    /**
+     * Implement the get_transfer_dim method of Topology.
+     */
+    [[nodiscard]] int get_transfer_dim(DeviceId src, DeviceId dest) const noexcept override;
+
   private:
     /// BasicTopology instances per dimension.
     std::vector<std::unique_ptr<BasicTopology>> topology_per_dim;
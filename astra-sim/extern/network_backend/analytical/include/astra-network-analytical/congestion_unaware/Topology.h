@@ -6,6 +6,8 @@ LICENSE file in the root directory of this source tree.
 #pragma once
 
 #include "common/Type.h"
+#include "congestion_unaware/ContentionModel.h"
+#include <memory>
 #include <vector>
 
 using namespace NetworkAnalytical;
@@ -33,6 +35,46 @@ class Topology {
      */
     [[nodiscard]] virtual EventTime send(DeviceId src, DeviceId dest, ChunkSize chunk_size) const noexcept = 0;
 
+    /**
+     * Estimate the time to be taken to transmit a chunk of size chunk_size
+     * from src NPU to dest NPU, which starts at send_time.
+     * If the contention model is enabled, the transfer is booked on it
+     * and stretched by the load of concurrent transfers.
+     * Otherwise, this is the same as send().
+     *
+     * @param src src NPU ID
+     * @param dest dest NPU ID
+     * @param chunk_size size of the chunk to send
+     * @param send_time time the transfer starts, non-decreasing over the calls
+     * @return time to send the chunk from src to dest
+     */
+    [[nodiscard]] EventTime send_at(DeviceId src, DeviceId dest, ChunkSize chunk_size, EventTime send_time) noexcept;
+
+    /**
+     * Get the number of hops a transfer from src NPU to dest NPU takes,
+     * which crosses every dimension where src and dest differ.
+     *
+     * @param src src NPU ID
+     * @param dest dest NPU ID
+     * @return number of hops between src and dest, 0 if src and dest are the same
+     */
+    [[nodiscard]] virtual int get_hops_count(DeviceId src, DeviceId dest) const noexcept = 0;
+
+    /**
+     * Let concurrent transfers of send_at() slow each other down.
+     *
+     * @param window length of a contention window in ns
+     */
+    void enable_contention_model(EventTime window) noexcept;
+
+    /**
+     * Check if concurrent transfers slow each other down,
+     * in which case send() is only a lower bound of the transfer time.
+     *
+     * @return true if the contention model is enabled, false otherwise
+     */
+    [[nodiscard]] bool is_contention_modeled() const noexcept;
+
     /**
      * Get the number of NPUs in the topology.
      *
@@ -62,6 +104,15 @@ class Topology {
     [[nodiscard]] std::vector<Bandwidth> get_bandwidth_per_dim() const noexcept;
 
   protected:
+    /**
+     * Get the dimension a transfer between src and dest happens in.
+     *
+     * @param src src NPU ID
+     * @param dest dest NPU ID
+     * @return dimension of the transfer
+     */
+    [[nodiscard]] virtual int get_transfer_dim(DeviceId src, DeviceId dest) const noexcept = 0;
+
     /// number of NPUs in the topology
     int npus_count;
 
@@ -73,6 +124,10 @@ class Topology {
 
     /// network bandwidth (GB/s) per each network dimension
     std::vector<Bandwidth> bandwidth_per_dim;
+
+  private:
+    /// contention model, nullptr if disabled
+    std::unique_ptr<ContentionModel> contention_model;
 };
 
 }  // namespace NetworkAnalyticalCongestionUnaware
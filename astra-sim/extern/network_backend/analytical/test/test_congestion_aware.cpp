@@ -9,6 +9,10 @@ LICENSE file in the root directory of this source tree.
 #include "congestion_aware/Chunk.h"
 #include "congestion_aware/Helper.h"
 #include <gtest/gtest.h>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
 
 using namespace NetworkAnalytical;
 using namespace NetworkAnalyticalCongestionAware;
@@ -28,6 +32,17 @@ class TestNetworkAnalyticalCongestionAware : public ::testing::Test {
 
     static void callback(void* const arg) {}
 
+    /// arrival time of a chunk, recorded by record_arrival
+    struct Arrival {
+        std::shared_ptr<EventQueue> event_queue;
+        EventTime time;
+    };
+
+    static void record_arrival(void* const arg) {
+        auto* const arrival = static_cast<Arrival*>(arg);
+        arrival->time = arrival->event_queue->get_current_time();
+    }
+
     ChunkSize chunk_size;
 };
 
@@ -132,3 +147,331 @@ TEST_F(TestNetworkAnalyticalCongestionAware, AllGatherOnRing) {
     const auto simulation_time = event_queue->get_current_time();
     EXPECT_EQ(simulation_time, 704'116);
 }
+
+TEST_F(TestNetworkAnalyticalCongestionAware, RingSingleHopSend) {
+    /// setup
+    const auto network_parser = NetworkParser("../../input/Ring.yml");
+    const auto topology = construct_topology(network_parser);
+
+    /// three chunks to the neighbor: the first skips the chunk object, the others queue up behind it
+    auto arrivals = std::vector<Arrival>(3, Arrival{event_queue, 0});
+    for (auto& arrival : arrivals) {
+        topology->send(1, 2, chunk_size, record_arrival, &arrival, 0, 0);
+    }
+
+    /// a multi-hop chunk follows its route, behind the three chunks
+    auto multi_hop_arrival = Arrival{event_queue, 0};
+    topology->send(1, 4, chunk_size, record_arrival, &multi_hop_arrival, 1, 0);
+
+    /// Run simulation
+    while (!event_queue->finished()) {
+        event_queue->proceed();
+    }
+
+    /// test: same timing as chunks sent through their routes
+    EXPECT_EQ(arrivals[0].time, 20'031);
+    EXPECT_EQ(arrivals[1].time, 20'031 + 19'531);
+    EXPECT_EQ(arrivals[2].time, 20'031 + (2 * 19'531));
+    EXPECT_EQ(multi_hop_arrival.time, 60'093 + (3 * 19'531));
+}
+
+TEST_F(TestNetworkAnalyticalCongestionAware, FatTree) {
+    /// setup
+    const auto network_parser = NetworkParser("../../input/FatTree.yml");
+    const auto topology = construct_topology(network_parser);
+
+    /// topology settings
+    EXPECT_EQ(topology->get_npus_count(), 8);
+    EXPECT_EQ(topology->get_devices_count(), 14);
+    EXPECT_EQ(topology->get_dims_count(), 2);
+
+    /// NPUs under the same leaf don't cross the spines
+    EXPECT_EQ(topology->route(0, 1).size(), 3);
+
+    /// message settings
+    auto route = topology->route(1, 4);
+    EXPECT_EQ(route.size(), 5);
+    auto chunk = std::make_unique<Chunk>(chunk_size, route, callback, nullptr);
+
+    // send a chunk
+    topology->send(std::move(chunk));
+
+    /// Run simulation
+    while (!event_queue->finished()) {
+        event_queue->proceed();
+    }
+
+    /// test
+    const auto simulation_time = event_queue->get_current_time();
+    EXPECT_EQ(simulation_time, 119'186);
+}
+
+TEST_F(TestNetworkAnalyticalCongestionAware, FatTreeOversubscribedSpine) {
+    /// setup
+    const auto network_parser = NetworkParser("../../input/FatTree.yml");
+    const auto topology = construct_topology(network_parser);
+
+    /// both chunks leave leaf 8 through the same uplink
+    for (int i = 0; i < 2; i++) {
+        auto route = topology->route(i, 4 + i);
+        auto chunk = std::make_unique<Chunk>(chunk_size, route, callback, nullptr);
+
+        // send a chunk
+        topology->send(std::move(chunk));
+    }
+
+    /// Run simulation
+    while (!event_queue->finished()) {
+        event_queue->proceed();
+    }
+
+    /// test
+    const auto simulation_time = event_queue->get_current_time();
+    EXPECT_EQ(simulation_time, 158'248);
+}
+
+TEST_F(TestNetworkAnalyticalCongestionAware, FatTreeEcmp) {
+    /// setup
+    const auto network_parser = NetworkParser("../../input/FatTree.yml");
+    const auto topology = construct_topology(network_parser);
+    topology->set_routing_policy(RoutingPolicy::Ecmp);
+
+    /// every chunk of a flow takes the same route
+    const auto first_route = topology->route_chunk(0, 4, 3, 0);
+    const auto second_route = topology->route_chunk(0, 4, 3, 1);
+    EXPECT_EQ(first_route, second_route);
+
+    /// flows from leaf 8 spread over both spines
+    for (int flow = 0; flow < 8; flow++) {
+        auto route = topology->route_chunk(0, 4, flow, 0);
+        EXPECT_EQ(route.size(), 5);
+        auto chunk = std::make_unique<Chunk>(chunk_size, route, callback, nullptr);
+
+        // send a chunk
+        topology->send(std::move(chunk));
+    }
+
+    /// Run simulation
+    while (!event_queue->finished()) {
+        event_queue->proceed();
+    }
+
+    /// test: faster than the 8 chunks through a single spine
+    const auto simulation_time = event_queue->get_current_time();
+    EXPECT_LT(simulation_time, 119'186 + 7 * 39'062);
+    EXPECT_EQ(simulation_time, 275'434);
+}
+
+TEST_F(TestNetworkAnalyticalCongestionAware, FatTreeSpray) {
+    /// setup
+    const auto network_parser = NetworkParser("../../input/FatTree.yml");
+    const auto topology = construct_topology(network_parser);
+    topology->set_routing_policy(RoutingPolicy::Spray);
+
+    /// chunks of a single flow spread over both spines
+    for (int chunk_id = 0; chunk_id < 8; chunk_id++) {
+        auto route = topology->route_chunk(0, 4, 0, chunk_id);
+        auto chunk = std::make_unique<Chunk>(chunk_size, route, callback, nullptr);
+
+        // send a chunk
+        topology->send(std::move(chunk));
+    }
+
+    /// Run simulation
+    while (!event_queue->finished()) {
+        event_queue->proceed();
+    }
+
+    /// test
+    const auto simulation_time = event_queue->get_current_time();
+    EXPECT_LT(simulation_time, 119'186 + 7 * 39'062);
+}
+
+TEST_F(TestNetworkAnalyticalCongestionAware, GraphParallelLinks) {
+    /// a second link between NPU 0 and switch 4 is rejected, even in the other direction
+    EXPECT_EXIT(NetworkParser("../../input/GraphParallelLinks.yml"), ::testing::ExitedWithCode(255),
+                "link \\(4 -> 0\\) is given more than once");
+}
+
+TEST_F(TestNetworkAnalyticalCongestionAware, RingEcmpHalfway) {
+    /// setup
+    const auto network_parser = NetworkParser("../../input/Ring.yml");
+    const auto topology = construct_topology(network_parser);
+    const auto npus_count = topology->get_npus_count();
+    const auto dest = npus_count / 2;
+
+    /// both directions are used halfway around the ring
+    auto second_devices = std::set<DeviceId>();
+    for (uint64_t hash = 0; hash < 16; hash++) {
+        const auto route = topology->route_with_hash(0, dest, hash);
+        EXPECT_EQ(route.size(), dest + 1);
+        second_devices.insert((*std::next(route.begin()))->get_id());
+    }
+    EXPECT_EQ(second_devices, std::set<DeviceId>({1, npus_count - 1}));
+
+    /// a single shortest route otherwise
+    EXPECT_EQ(topology->route_with_hash(0, 1, 5), topology->route(0, 1));
+}
+
+TEST_F(TestNetworkAnalyticalCongestionAware, HopsCountMatchesRoute) {
+    for (const auto* const network : {"../../input/Ring.yml", "../../input/Switch.yml", "../../input/FatTree.yml",
+                                      "../../input/Ring_FullyConnected_Switch.yml"}) {
+        /// setup
+        const auto network_parser = NetworkParser(network);
+        const auto topology = construct_topology(network_parser);
+        const auto npus_count = topology->get_npus_count();
+
+        /// test: the hop counts computed without routes match the routes
+        for (auto src = 0; src < npus_count; src++) {
+            for (auto dest = 0; dest < npus_count; dest++) {
+                if (src == dest) {
+                    continue;
+                }
+                EXPECT_EQ(topology->get_hops_count(src, dest), topology->route(src, dest).size() - 1);
+            }
+        }
+    }
+}
+
+TEST_F(TestNetworkAnalyticalCongestionAware, LinkTelemetry) {
+    /// setup
+    const auto network_parser = NetworkParser("../../input/Switch.yml");
+    const auto topology = construct_topology(network_parser);
+    Topology::set_link_telemetry_enabled(true);
+
+    /// three chunks queue up on the uplink of NPU 0
+    for (int i = 0; i < 3; i++) {
+        auto route = topology->route(0, 1);
+        auto chunk = std::make_unique<Chunk>(chunk_size, route, callback, nullptr);
+
+        // send a chunk
+        topology->send(std::move(chunk));
+    }
+
+    /// Run simulation
+    while (!event_queue->finished()) {
+        event_queue->proceed();
+    }
+
+    /// test: the uplink was busy for 3 chunks, while 2 and then 1 chunk waited
+    auto out = std::stringstream();
+    topology->dump_link_telemetry(out, event_queue->get_current_time());
+    auto line = std::string();
+    std::getline(out, line);
+    EXPECT_EQ(line, "src,dest,bytes,chunks,busy_ns,utilization,max_queue,queueing_delay_ns");
+    std::getline(out, line);
+    EXPECT_EQ(line, "0,16,3145728,3,58593,0.740521,2,58593");
+    std::getline(out, line);
+    EXPECT_EQ(line.substr(0, 5), "16,1,");
+    EXPECT_FALSE(std::getline(out, line));
+
+    /// telemetry is off unless the network input asks for it
+    Topology::set_link_telemetry_enabled(false);
+}
+
+TEST_F(TestNetworkAnalyticalCongestionAware, LinkTelemetryDisabled) {
+    /// setup
+    const auto network_parser = NetworkParser("../../input/Switch.yml");
+    const auto topology = construct_topology(network_parser);
+
+    /// message settings
+    auto route = topology->route(0, 1);
+    auto chunk = std::make_unique<Chunk>(chunk_size, route, callback, nullptr);
+
+    // send a chunk
+    topology->send(std::move(chunk));
+
+    /// Run simulation
+    while (!event_queue->finished()) {
+        event_queue->proceed();
+    }
+
+    /// test: no counters are collected
+    auto out = std::stringstream();
+    topology->dump_link_telemetry(out, event_queue->get_current_time());
+    auto line = std::string();
+    std::getline(out, line);
+    EXPECT_FALSE(std::getline(out, line));
+}
+
+TEST_F(TestNetworkAnalyticalCongestionAware, RingSlowLink) {
+    /// setup
+    const auto network_parser = NetworkParser("../../input/RingSlowLink.yml");
+    const auto topology = construct_topology(network_parser);
+
+    /// message settings: 1 -> 2 -> 3 -> 4, crossing the slow link
+    auto route = topology->route(1, 4);
+    auto chunk = std::make_unique<Chunk>(chunk_size, route, callback, nullptr);
+
+    // send a chunk
+    topology->send(std::move(chunk));
+
+    /// Run simulation
+    while (!event_queue->finished()) {
+        event_queue->proceed();
+    }
+
+    /// test: one of the three hops takes twice as long to serialize
+    const auto simulation_time = event_queue->get_current_time();
+    EXPECT_EQ(simulation_time, 60'093 + 19'531);
+}
+
+TEST_F(TestNetworkAnalyticalCongestionAware, SwitchLinkOverride) {
+    /// setup
+    const auto network_parser = NetworkParser("../../input/Switch.yml");
+    const auto topology = construct_topology(network_parser);
+
+    /// only the downlink from the switch to NPU 1 gets slower
+    topology->override_link({16, 1, std::nullopt, 2'500.0, /* bidirectional = */ false});
+
+    /// message settings
+    for (const auto& [src, dest] : {std::pair(0, 1), std::pair(1, 0)}) {
+        auto route = topology->route(src, dest);
+        auto chunk = std::make_unique<Chunk>(chunk_size, route, callback, nullptr);
+
+        // send a chunk
+        topology->send(std::move(chunk));
+    }
+
+    /// Run simulation
+    while (!event_queue->finished()) {
+        event_queue->proceed();
+    }
+
+    /// test: the chunk to NPU 1 takes 2'000 ns longer than the unchanged 40'062
+    const auto simulation_time = event_queue->get_current_time();
+    EXPECT_EQ(simulation_time, 40'062 + 2'000);
+}
+
+TEST_F(TestNetworkAnalyticalCongestionAware, SwitchHeadOfLineBlocking) {
+    for (const auto* const network : {"../../input/Switch.yml", "../../input/SwitchFiniteBuffer.yml"}) {
+        /// setup
+        event_queue = std::make_shared<EventQueue>();
+        Topology::set_event_queue(event_queue);
+        const auto network_parser = NetworkParser(network);
+        const auto topology = construct_topology(network_parser);
+
+        /// NPUs 1 to 4 incast into NPU 0, then NPU 1 sends to the idle NPU 5
+        auto arrival = Arrival{event_queue, 0};
+        for (const auto& [src, dest] : {std::pair(1, 0), std::pair(2, 0), std::pair(3, 0), std::pair(4, 0)}) {
+            auto chunk = std::make_unique<Chunk>(chunk_size, topology->route(src, dest), callback, nullptr);
+            topology->send(std::move(chunk));
+        }
+        auto chunk = std::make_unique<Chunk>(chunk_size, topology->route(1, 5), record_arrival, &arrival);
+        topology->send(std::move(chunk));
+
+        /// Run simulation
+        while (!event_queue->finished()) {
+            event_queue->proceed();
+        }
+
+        /// test: the incast takes equally long, but with a single-chunk buffer, the chunk to NPU 5
+        /// waits in NPU 1 until its chunk to NPU 0 left the switch
+        EXPECT_EQ(event_queue->get_current_time(), 2 * 20'031 + 3 * 19'531);
+        if (network_parser.get_link_buffer_size() == 0) {
+            EXPECT_EQ(arrival.time, 2 * 19'531 + 2 * 500 + 19'531);
+        } else {
+            EXPECT_EQ(arrival.time, 20'031 + 19'531 + 2 * 20'031);
+        }
+    }
+}
@@ -68,3 +68,55 @@ TEST_F(TestNetworkAnalyticalCongestionUnaware, Ring_FullyConnected_Switch) {
     const auto comm_delay_dim3 = topology->send(26, 42, chunk_size);
     EXPECT_EQ(comm_delay_dim3, 23'531);
 }
+
+TEST_F(TestNetworkAnalyticalCongestionUnaware, Ring_FullyConnected_Switch_HopsCount) {
+    // create network
+    const auto network_parser = NetworkParser("../../input/Ring_FullyConnected_Switch.yml");
+    const auto topology = construct_topology(network_parser);
+
+    // same NPU
+    EXPECT_EQ(topology->get_hops_count(5, 5), 0);
+
+    // single dimension
+    EXPECT_EQ(topology->get_hops_count(0, 1), 1);
+    EXPECT_EQ(topology->get_hops_count(37, 41), 1);
+    EXPECT_EQ(topology->get_hops_count(26, 42), 2);
+
+    // every dimension: ring, fully connected, then switch
+    EXPECT_EQ(topology->get_hops_count(0, 63), 4);
+}
+
+TEST_F(TestNetworkAnalyticalCongestionUnaware, RingContention) {
+    // create network
+    const auto network_parser = NetworkParser("../../input/RingContention.yml");
+    const auto topology = construct_topology(network_parser);
+    EXPECT_TRUE(topology->is_contention_modeled());
+
+    // a transfer on idle ports isn't slowed down
+    const auto comm_delay = topology->send_at(0, 1, chunk_size, 0);
+    EXPECT_EQ(comm_delay, 20'031);
+
+    // a concurrent transfer into NPU 1 shares its ingress port
+    // during (almost) the whole serialization, so it takes about twice as long
+    const auto contended_comm_delay = topology->send_at(2, 1, chunk_size, 0);
+    EXPECT_EQ(contended_comm_delay, 39'313);
+
+    // transfers on other ports aren't affected
+    const auto other_comm_delay = topology->send_at(4, 5, chunk_size, 0);
+    EXPECT_EQ(other_comm_delay, 20'031);
+
+    // nor are transfers after the contended ones finished
+    const auto later_comm_delay = topology->send_at(0, 1, chunk_size, 100'000);
+    EXPECT_EQ(later_comm_delay, 20'031);
+}
+
+TEST_F(TestNetworkAnalyticalCongestionUnaware, RingWithoutContention) {
+    // create network
+    const auto network_parser = NetworkParser("../../input/Ring.yml");
+    const auto topology = construct_topology(network_parser);
+    EXPECT_FALSE(topology->is_contention_modeled());
+
+    // concurrent transfers don't interact
+    EXPECT_EQ(topology->send_at(0, 1, chunk_size, 0), 20'031);
+    EXPECT_EQ(topology->send_at(2, 1, chunk_size, 0), 20'031);
+}
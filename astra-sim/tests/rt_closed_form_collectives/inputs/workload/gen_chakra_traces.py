@@ -0,0 +1,72 @@
+import os
+
+from chakra.src.third_party.utils.protolib import encodeMessage as encode_message
+from chakra.schema.protobuf.et_def_pb2 import (
+    Node as ChakraNode,
+    BoolList,
+    GlobalMetadata,
+    AttributeProto as ChakraAttr,
+    COMP_NODE,
+    COMM_COLL_NODE,
+    ALL_REDUCE,
+    REDUCE_SCATTER,
+    ALL_GATHER,
+    ALL_TO_ALL,
+)
+
+def main() -> None:
+    # metadata
+    npus_count = 8  # 8 NPUs
+    colls = [
+        ("All-Reduce", ALL_REDUCE, 4_194_304),  # 4 MB
+        ("Reduce-Scatter", REDUCE_SCATTER, 1_048_576),  # 1 MB
+        ("All-Gather", ALL_GATHER, 262_144),  # 256 KB
+        ("All-to-All", ALL_TO_ALL, 1_048_576),  # 1 MB
+    ]
+
+    compute_id = len(colls) + 1
+    compute_time = 5  # us, per NPU id
+
+    # dependencies of each collective: one after another (serial), with
+    # the all-gather independent of the all-reduce (overlapping), or one after
+    # another after a compute that takes longer on each NPU (skewed)
+    workloads = {
+        "serial": [[], [1], [2], [3]],
+        "overlapping": [[], [1, 3], [], [2]],
+        "skewed": [[compute_id], [1], [2], [3]],
+    }
+
+    for workload, deps in workloads.items():
+        for npu_id in range(npus_count):
+            output_filename = f"{workload}_trace.{npu_id}.et"
+            with open(output_filename, "wb") as et:
+                # Chakra Metadata
+                encode_message(et, GlobalMetadata(version="0.0.4"))
+
+                if workload == "skewed":
+                    node = ChakraNode()
+                    node.id = compute_id
+                    node.name = "Compute"
+                    node.type = COMP_NODE
+                    node.duration_micros = (npu_id + 1) * compute_time
+                    node.attr.append(ChakraAttr(name="is_cpu_op", bool_val=False))
+                    encode_message(et, node)
+
+                for node_id, (name, comm_type, coll_size) in enumerate(colls, 1):
+                    # create Chakra Node
+                    node = ChakraNode()
+                    node.id = node_id
+                    node.name = name
+                    node.type = COMM_COLL_NODE
+                    node.data_deps.extend(deps[node_id - 1])
+
+                    # assign attributes
+                    node.attr.append(ChakraAttr(name="is_cpu_op", bool_val=False))
+                    node.attr.append(ChakraAttr(name="comm_type", int64_val=comm_type))
+                    node.attr.append(ChakraAttr(name="comm_size", int64_val=coll_size))
+
+                    # store Chakra ET file
+                    encode_message(et, node)
+
+if __name__ == "__main__":
+    main()
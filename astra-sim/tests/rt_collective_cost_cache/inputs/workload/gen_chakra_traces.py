@@ -0,0 +1,111 @@
+import os
+
+from chakra.src.third_party.utils.protolib import encodeMessage as encode_message
+from chakra.schema.protobuf.et_def_pb2 import (
+    Node as ChakraNode,
+    BoolList,
+    GlobalMetadata,
+    AttributeProto as ChakraAttr,
+    COMP_NODE,
+    COMM_COLL_NODE,
+    ALL_REDUCE,
+)
+
+def compute_node(node_id: int, duration: int, deps: list) -> ChakraNode:
+    node = ChakraNode()
+    node.id = node_id
+    node.name = "Compute"
+    node.type = COMP_NODE
+    node.duration_micros = duration
+    node.data_deps.extend(deps)
+    node.attr.append(ChakraAttr(name="is_cpu_op", bool_val=False))
+    return node
+
+def all_reduce_node(node_id: int, coll_size: int, deps: list) -> ChakraNode:
+    node = ChakraNode()
+    node.id = node_id
+    node.name = "All-Reduce"
+    node.type = COMM_COLL_NODE
+    node.data_deps.extend(deps)
+    node.attr.append(ChakraAttr(name="is_cpu_op", bool_val=False))
+    node.attr.append(ChakraAttr(name="comm_type", int64_val=ALL_REDUCE))
+    node.attr.append(ChakraAttr(name="comm_size", int64_val=coll_size))
+    return node
+
+def main() -> None:
+    # metadata
+    npus_count = 8  # 8 NPUs
+    iterations = 4
+    compute_time = 50  # us
+    coll_sizes = [
+        1_048_576,  # 1 MB
+        262_144,  # 256 KB
+    ]
+
+    # serial: the all-reduces of an iteration run one after another
+    for npu_id in range(npus_count):
+        output_filename = f"serial_trace.{npu_id}.et"
+        with open(output_filename, "wb") as et:
+            # Chakra Metadata
+            encode_message(et, GlobalMetadata(version="0.0.4"))
+
+            node_id = 0
+            for _ in range(iterations):
+                # compute between the iterations, the network is idle
+                deps = [node_id] if node_id > 0 else []
+                encode_message(et, compute_node(node_id + 1, compute_time, deps))
+                node_id += 1
+
+                for coll_size in coll_sizes:
+                    encode_message(et, all_reduce_node(node_id + 1, coll_size, [node_id]))
+                    node_id += 1
+
+    # overlapping: NPUs 0-3 and 4-7 form two communicator groups, the first
+    # runs the 1 MB all-reduces and the second the 256 KB ones; the first
+    # 256 KB all-reduce starts while the last 1 MB one is replayed
+    group_compute_times = [
+        [compute_time] * iterations,
+        [390, 40, 80, 90],  # us
+    ]
+    for npu_id in range(npus_count):
+        group = npu_id // (npus_count // 2)
+        output_filename = f"overlapping_trace.{npu_id}.et"
+        with open(output_filename, "wb") as et:
+            # Chakra Metadata
+            encode_message(et, GlobalMetadata(version="0.0.4"))
+
+            node_id = 0
+            for group_compute_time in group_compute_times[group]:
+                deps = [node_id] if node_id > 0 else []
+                encode_message(et, compute_node(node_id + 1, group_compute_time, deps))
+                node_id += 1
+
+                encode_message(et, all_reduce_node(node_id + 1, coll_sizes[group], [node_id]))
+                node_id += 1
+
+    # skewed: NPU 0 issues the 256 KB all-reduces 10 us after the others until
+    # the recording is replayed once; the next one NPU 0 issues with another
+    # skew, so the others turn their replays into simulations and the
+    # all-reduce is recorded again; the last one NPU 0 issues only after the
+    # replays of the others would have finished
+    skewed_compute_times = [
+        [60, 60, 60, 60, 50, 50, 50, 2000],  # us
+        [50] * 8,  # us
+    ]
+    for npu_id in range(npus_count):
+        output_filename = f"skewed_trace.{npu_id}.et"
+        with open(output_filename, "wb") as et:
+            # Chakra Metadata
+            encode_message(et, GlobalMetadata(version="0.0.4"))
+
+            node_id = 0
+            for skewed_compute_time in skewed_compute_times[min(npu_id, 1)]:
+                deps = [node_id] if node_id > 0 else []
+                encode_message(et, compute_node(node_id + 1, skewed_compute_time, deps))
+                node_id += 1
+
+                encode_message(et, all_reduce_node(node_id + 1, coll_sizes[1], [node_id]))
+                node_id += 1
+
+if __name__ == "__main__":
+    main()
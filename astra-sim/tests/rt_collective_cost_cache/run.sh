@@ -0,0 +1,62 @@
+#!/bin/bash
+set -e
+
+# Path
+SCRIPT_DIR=$(dirname "$(realpath $0)")
+ASTRA_SIM_BIN=${SCRIPT_DIR}/../../build/astra_analytical/build/bin/AstraSim_Analytical_Congestion_Aware
+
+# Runs without and with the collective cost cache, each with its own system
+# configuration, on all-reduces that run one after another (serial), that
+# overlap (overlapping) and that are issued with changing skews (skewed), with
+# one reference per workload and configuration
+IMPLS="simulated cached"
+WORKLOADS="serial overlapping skewed"
+
+# Clear outputs
+(
+rm -rf ${SCRIPT_DIR}/outputs/*
+)
+
+# Generate inputs
+(
+echo "[$0] Generating inputs..."
+${SCRIPT_DIR}/inputs/workload/gen.sh
+)
+
+# Run ASTRA-sim once per workload and implementation
+for workload in ${WORKLOADS}; do
+# only the overlapping workload uses communicator groups
+COMM_GROUP=empty
+if [ ${workload} = overlapping ]; then
+    COMM_GROUP=${SCRIPT_DIR}/inputs/comm_group.json
+fi
+for impl in ${IMPLS}; do
+(
+echo "[$0] Running ASTRA-sim (${workload}, ${impl})..."
+${ASTRA_SIM_BIN} \
+    --workload-configuration=${SCRIPT_DIR}/inputs/workload/${workload}_trace \
+    --system-configuration=${SCRIPT_DIR}/inputs/system_cfg_${impl}.json \
+    --network-configuration=${SCRIPT_DIR}/inputs/network_cfg.yml \
+    --remote-memory-configuration=${SCRIPT_DIR}/inputs/remote_memory_cfg.json \
+    --comm-group-configuration=${COMM_GROUP} \
+	| tee ${SCRIPT_DIR}/outputs/stdout_${workload}_${impl}.txt
+)
+done
+done
+
+clean_log() {
+    sed -E 's/\[[^]]+\] //; s/\[[^]]+\] //; s/\[[^]]+\] //'
+}
+
+# Compare outputs
+for workload in ${WORKLOADS}; do
+for impl in ${IMPLS}; do
+(
+echo "[$0] Comparing outputs (${workload}, ${impl})..."
+clean_log < ${SCRIPT_DIR}/outputs/stdout_${workload}_${impl}.txt > ${SCRIPT_DIR}/outputs/stdout_${workload}_${impl}_clean.txt
+diff ${SCRIPT_DIR}/outputs/stdout_${workload}_${impl}_clean.txt ${SCRIPT_DIR}/refs/stdout_${workload}_${impl}.txt || (echo "Failed." ; exit 1)
+)
+done
+done
+
+echo "[$0] Ok."
@@ -0,0 +1,47 @@
+import os
+
+from chakra.src.third_party.utils.protolib import encodeMessage as encode_message
+from chakra.schema.protobuf.et_def_pb2 import (
+    Node as ChakraNode,
+    BoolList,
+    GlobalMetadata,
+    AttributeProto as ChakraAttr,
+    COMM_COLL_NODE,
+    ALL_TO_ALL,
+)
+
+def main() -> None:
+    # metadata
+    npus_count = 8  # 8 NPUs
+    # on a switch, the chunks all NPUs send to one NPU share the link from the
+    # switch to it, so the all-to-alls make the switch buffer chunks
+    colls = [
+        ("All-to-All", ALL_TO_ALL, 1_048_576),  # 1 MB
+        ("All-to-All", ALL_TO_ALL, 4_194_304),  # 4 MB
+    ]
+
+    for npu_id in range(npus_count):
+        output_filename = f"chakra_trace.{npu_id}.et"
+        with open(output_filename, "wb") as et:
+            # Chakra Metadata
+            encode_message(et, GlobalMetadata(version="0.0.4"))
+
+            for node_id, (name, comm_type, coll_size) in enumerate(colls, 1):
+                # create Chakra Node
+                node = ChakraNode()
+                node.id = node_id
+                node.name = name
+                node.type = COMM_COLL_NODE
+                if node_id > 1:
+                    node.data_deps.append(node_id - 1)
+
+                # assign attributes
+                node.attr.append(ChakraAttr(name="is_cpu_op", bool_val=False))
+                node.attr.append(ChakraAttr(name="comm_type", int64_val=comm_type))
+                node.attr.append(ChakraAttr(name="comm_size", int64_val=coll_size))
+
+                # store Chakra ET file
+                encode_message(et, node)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,53 @@
+import os
+
+from chakra.src.third_party.utils.protolib import encodeMessage as encode_message
+from chakra.schema.protobuf.et_def_pb2 import (
+    Node as ChakraNode,
+    BoolList,
+    GlobalMetadata,
+    AttributeProto as ChakraAttr,
+    COMM_SEND_NODE,
+    COMM_RECV_NODE,
+)
+
+def p2p_node(node_id: int, node_type: int, src: int, dst: int, size: int) -> ChakraNode:
+    node = ChakraNode()
+    node.id = node_id
+    node.name = "Send" if node_type == COMM_SEND_NODE else "Recv"
+    node.type = node_type
+    node.attr.append(ChakraAttr(name="is_cpu_op", bool_val=False))
+    node.attr.append(ChakraAttr(name="comm_src", int32_val=src))
+    node.attr.append(ChakraAttr(name="comm_dst", int32_val=dst))
+    node.attr.append(ChakraAttr(name="comm_tag", int32_val=0))
+    node.attr.append(ChakraAttr(name="comm_size", int64_val=size))
+    return node
+
+def main() -> None:
+    # metadata
+    npus_count = 8  # 8 NPUs
+    message_size = 1_048_576  # 1 MB
+
+    # every NPU sends a message to each of its two ring neighbors, so only the
+    # messages between NPUs 3 and 4 cross the overridden link
+    for npu_id in range(npus_count):
+        neighbors = [(npu_id + 1) % npus_count, (npu_id - 1) % npus_count]
+        output_filename = f"chakra_trace.{npu_id}.et"
+        with open(output_filename, "wb") as et:
+            # Chakra Metadata
+            encode_message(et, GlobalMetadata(version="0.0.4"))
+
+            node_id = 0
+            for neighbor in neighbors:
+                node_id += 1
+                encode_message(et, p2p_node(node_id, COMM_RECV_NODE, neighbor, npu_id, message_size))
+
+            # the sends of an NPU run one after another
+            for neighbor in neighbors:
+                node_id += 1
+                node = p2p_node(node_id, COMM_SEND_NODE, npu_id, neighbor, message_size)
+                if neighbor != neighbors[0]:
+                    node.data_deps.append(node_id - 1)
+                encode_message(et, node)
+
+if __name__ == "__main__":
+    main()
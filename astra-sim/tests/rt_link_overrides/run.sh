@@ -0,0 +1,48 @@
+#!/bin/bash
+set -e
+
+# Path
+SCRIPT_DIR=$(dirname "$(realpath $0)")
+ASTRA_SIM_BIN=${SCRIPT_DIR}/../../build/astra_analytical/build/bin/AstraSim_Analytical_Congestion_Aware
+
+# Networks under test, each with its own network configuration and reference
+IMPLS="uniform slowLink"
+
+# Clear outputs
+(
+rm -rf ${SCRIPT_DIR}/outputs/*
+)
+
+# Generate inputs
+(
+echo "[$0] Generating inputs..."
+${SCRIPT_DIR}/inputs/workload/gen.sh
+)
+
+# Run ASTRA-sim once per network
+for impl in ${IMPLS}; do
+(
+echo "[$0] Running ASTRA-sim (${impl})..."
+${ASTRA_SIM_BIN} \
+    --workload-configuration=${SCRIPT_DIR}/inputs/workload/chakra_trace \
+    --system-configuration=${SCRIPT_DIR}/inputs/system_cfg.json \
+    --network-configuration=${SCRIPT_DIR}/inputs/network_cfg_${impl}.yml \
+    --remote-memory-configuration=${SCRIPT_DIR}/inputs/remote_memory_cfg.json \
+	| tee ${SCRIPT_DIR}/outputs/stdout_${impl}.txt
+)
+done
+
+clean_log() {
+    sed -E 's/\[[^]]+\] //; s/\[[^]]+\] //; s/\[[^]]+\] //'
+}
+
+# Compare outputs
+for impl in ${IMPLS}; do
+(
+echo "[$0] Comparing outputs (${impl})..."
+clean_log < ${SCRIPT_DIR}/outputs/stdout_${impl}.txt > ${SCRIPT_DIR}/outputs/stdout_${impl}_clean.txt
+diff ${SCRIPT_DIR}/outputs/stdout_${impl}_clean.txt ${SCRIPT_DIR}/refs/stdout_${impl}.txt || (echo "Failed." ; exit 1)
+)
+done
+
+echo "[$0] Ok."
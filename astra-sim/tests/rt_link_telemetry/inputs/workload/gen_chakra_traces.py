@@ -0,0 +1,59 @@
+import os
+
+from chakra.src.third_party.utils.protolib import encodeMessage as encode_message
+from chakra.schema.protobuf.et_def_pb2 import (
+    Node as ChakraNode,
+    BoolList,
+    GlobalMetadata,
+    AttributeProto as ChakraAttr,
+    COMM_SEND_NODE,
+    COMM_RECV_NODE,
+)
+
+def p2p_node(node_id: int, node_type: int, src: int, dst: int, tag: int, size: int) -> ChakraNode:
+    node = ChakraNode()
+    node.id = node_id
+    node.name = "Send" if node_type == COMM_SEND_NODE else "Recv"
+    node.type = node_type
+    node.attr.append(ChakraAttr(name="is_cpu_op", bool_val=False))
+    node.attr.append(ChakraAttr(name="comm_src", int32_val=src))
+    node.attr.append(ChakraAttr(name="comm_dst", int32_val=dst))
+    node.attr.append(ChakraAttr(name="comm_tag", int32_val=tag))
+    node.attr.append(ChakraAttr(name="comm_size", int64_val=size))
+    return node
+
+def main() -> None:
+    # metadata
+    npus_count = 8  # 8 NPUs
+    messages_count = 4
+    message_size = 262_144  # 256 KB
+
+    # NPUs 0 and 1 behind leaf switch 8 send to NPUs 4 and 6 behind leaf
+    # switches 10 and 11; both flows share the uplink from leaf 8 to the spine
+    # and split up behind it
+    flows = {0: 4, 1: 6}
+    for npu_id in range(npus_count):
+        output_filename = f"chakra_trace.{npu_id}.et"
+        with open(output_filename, "wb") as et:
+            # Chakra Metadata
+            encode_message(et, GlobalMetadata(version="0.0.4"))
+
+            node_id = 0
+            for src, dst in flows.items():
+                if npu_id != dst:
+                    continue
+                for tag in range(messages_count):
+                    node_id += 1
+                    encode_message(et, p2p_node(node_id, COMM_RECV_NODE, src, dst, tag, message_size))
+
+            # the sends of an NPU run one after another
+            if npu_id in flows:
+                for tag in range(messages_count):
+                    node_id += 1
+                    node = p2p_node(node_id, COMM_SEND_NODE, npu_id, flows[npu_id], tag, message_size)
+                    if tag > 0:
+                        node.data_deps.append(node_id - 1)
+                    encode_message(et, node)
+
+if __name__ == "__main__":
+    main()
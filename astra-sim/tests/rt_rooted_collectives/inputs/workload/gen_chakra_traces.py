@@ -0,0 +1,61 @@
+import os
+
+from chakra.src.third_party.utils.protolib import encodeMessage as encode_message
+from chakra.schema.protobuf.et_def_pb2 import (
+    Node as ChakraNode,
+    BoolList,
+    GlobalMetadata,
+    AttributeProto as ChakraAttr,
+    COMM_COLL_NODE,
+    BROADCAST,
+    REDUCE,
+    GATHER,
+)
+
+def main() -> None:
+    # metadata
+    npus_count = 8  # 8 NPUs
+    colls = [
+        ("Broadcast", BROADCAST, 4_194_304, 5),  # 4 MB from NPU 5
+        ("Reduce", REDUCE, 4_194_304, 2),  # 4 MB to NPU 2
+        ("Gather", GATHER, 1_048_576, 6),  # 1 MB per NPU to NPU 6
+    ]
+    # the collectives run one after the other
+    deps = {2: [1], 3: [2]}
+    write_traces("chakra_trace", npus_count, colls, deps)
+
+    # the same collectives within the communicator groups of NPUs 0-3 and
+    # 4-7, where comm_src is the rank of the root within the group
+    group_colls = [
+        ("Broadcast", BROADCAST, 4_194_304, 1),  # 4 MB from rank 1
+        ("Reduce", REDUCE, 4_194_304, 2),  # 4 MB to rank 2
+        ("Gather", GATHER, 1_048_576, 3),  # 1 MB per NPU to rank 3
+    ]
+    write_traces("grouped_trace", npus_count, group_colls, deps)
+
+def write_traces(prefix: str, npus_count: int, colls: list, deps: dict) -> None:
+    for npu_id in range(npus_count):
+        output_filename = f"{prefix}.{npu_id}.et"
+        with open(output_filename, "wb") as et:
+            # Chakra Metadata
+            encode_message(et, GlobalMetadata(version="0.0.4"))
+
+            for node_id, (name, comm_type, coll_size, root) in enumerate(colls, 1):
+                # create Chakra Node
+                node = ChakraNode()
+                node.id = node_id
+                node.name = name
+                node.type = COMM_COLL_NODE
+                node.data_deps.extend(deps.get(node_id, []))
+
+                # assign attributes
+                node.attr.append(ChakraAttr(name="is_cpu_op", bool_val=False))
+                node.attr.append(ChakraAttr(name="comm_type", int64_val=comm_type))
+                node.attr.append(ChakraAttr(name="comm_size", int64_val=coll_size))
+                node.attr.append(ChakraAttr(name="comm_src", int32_val=root))
+
+                # store Chakra ET file
+                encode_message(et, node)
+
+if __name__ == "__main__":
+    main()
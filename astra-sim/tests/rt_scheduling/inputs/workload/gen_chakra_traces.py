@@ -0,0 +1,50 @@
+import os
+
+from chakra.src.third_party.utils.protolib import encodeMessage as encode_message
+from chakra.schema.protobuf.et_def_pb2 import (
+    Node as ChakraNode,
+    BoolList,
+    GlobalMetadata,
+    AttributeProto as ChakraAttr,
+    COMM_COLL_NODE,
+    ALL_REDUCE,
+    ALL_GATHER,
+    REDUCE_SCATTER,
+)
+
+def main() -> None:
+    # metadata
+    npus_count = 8  # 8 NPUs
+    colls = [
+        ("All-Reduce", ALL_REDUCE, 4_194_304),  # 4 MB
+        ("All-Gather", ALL_GATHER, 1_048_576),  # 1 MB
+        ("Reduce-Scatter", REDUCE_SCATTER, 2_097_152),  # 2 MB
+    ]
+    # the reduce-scatter waits for the all-gather, so the order in which the
+    # chunks of the concurrent collectives are scheduled shows in the result
+    deps = {3: [2]}
+
+    for npu_id in range(npus_count):
+        output_filename = f"chakra_trace.{npu_id}.et"
+        with open(output_filename, "wb") as et:
+            # Chakra Metadata
+            encode_message(et, GlobalMetadata(version="0.0.4"))
+
+            for node_id, (name, comm_type, coll_size) in enumerate(colls, 1):
+                # create Chakra Node
+                node = ChakraNode()
+                node.id = node_id
+                node.name = name
+                node.type = COMM_COLL_NODE
+                node.data_deps.extend(deps.get(node_id, []))
+
+                # assign attributes
+                node.attr.append(ChakraAttr(name="is_cpu_op", bool_val=False))
+                node.attr.append(ChakraAttr(name="comm_type", int64_val=comm_type))
+                node.attr.append(ChakraAttr(name="comm_size", int64_val=coll_size))
+
+                # store Chakra ET file
+                encode_message(et, node)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,48 @@
+#!/bin/bash
+set -e
+
+# Path
+SCRIPT_DIR=$(dirname "$(realpath $0)")
+ASTRA_SIM_BIN=${SCRIPT_DIR}/../../build/astra_analytical/build/bin/AstraSim_Analytical_Congestion_Aware
+
+# Scheduling policies under test, each with its own system configuration and reference
+POLICIES="FIFO RG smallestFirst lessRemainingPhaseFirst onlineGreedy roundRobin offlineGreedy offlineGreedyFlex"
+
+# Clear outputs
+(
+rm -rf ${SCRIPT_DIR}/outputs/*
+)
+
+# Generate inputs
+(
+echo "[$0] Generating inputs..."
+${SCRIPT_DIR}/inputs/workload/gen.sh
+)
+
+# Run ASTRA-sim once per scheduling policy
+for policy in ${POLICIES}; do
+(
+echo "[$0] Running ASTRA-sim (${policy})..."
+${ASTRA_SIM_BIN} \
+    --workload-configuration=${SCRIPT_DIR}/inputs/workload/chakra_trace \
+    --system-configuration=${SCRIPT_DIR}/inputs/system_cfg_${policy}.json \
+    --network-configuration=${SCRIPT_DIR}/inputs/network_cfg.yml \
+    --remote-memory-configuration=${SCRIPT_DIR}/inputs/remote_memory_cfg.json \
+	| tee ${SCRIPT_DIR}/outputs/stdout_${policy}.txt
+)
+done
+
+clean_log() {
+    sed -E 's/\[[^]]+\] //; s/\[[^]]+\] //; s/\[[^]]+\] //'
+}
+
+# Compare outputs
+for policy in ${POLICIES}; do
+(
+echo "[$0] Comparing outputs (${policy})..."
+clean_log < ${SCRIPT_DIR}/outputs/stdout_${policy}.txt > ${SCRIPT_DIR}/outputs/stdout_${policy}_clean.txt
+diff ${SCRIPT_DIR}/outputs/stdout_${policy}_clean.txt ${SCRIPT_DIR}/refs/stdout_${policy}.txt || (echo "Failed." ; exit 1)
+)
+done
+
+echo "[$0] Ok."
@@ -0,0 +1,53 @@
+import os
+
+from chakra.src.third_party.utils.protolib import encodeMessage as encode_message
+from chakra.schema.protobuf.et_def_pb2 import (
+    Node as ChakraNode,
+    BoolList,
+    GlobalMetadata,
+    AttributeProto as ChakraAttr,
+    COMP_NODE,
+    COMM_COLL_NODE,
+    ALL_REDUCE,
+)
+
+def compute_node(node_id: int, duration: int, deps: list) -> ChakraNode:
+    node = ChakraNode()
+    node.id = node_id
+    node.name = "Compute"
+    node.type = COMP_NODE
+    node.duration_micros = duration
+    node.data_deps.extend(deps)
+    node.attr.append(ChakraAttr(name="is_cpu_op", bool_val=False))
+    return node
+
+def all_reduce_node(node_id: int, coll_size: int, deps: list) -> ChakraNode:
+    node = ChakraNode()
+    node.id = node_id
+    node.name = "All-Reduce"
+    node.type = COMM_COLL_NODE
+    node.data_deps.extend(deps)
+    node.attr.append(ChakraAttr(name="is_cpu_op", bool_val=False))
+    node.attr.append(ChakraAttr(name="comm_type", int64_val=ALL_REDUCE))
+    node.attr.append(ChakraAttr(name="comm_size", int64_val=coll_size))
+    return node
+
+def main() -> None:
+    # metadata
+    npus_count = 8  # 8 NPUs
+    coll_size = 1_048_576  # 1 MB
+    compute_skew = 5  # us
+
+    # NPU i computes for i * 5 us before two all-reduces, one after another
+    for npu_id in range(npus_count):
+        output_filename = f"chakra_trace.{npu_id}.et"
+        with open(output_filename, "wb") as et:
+            # Chakra Metadata
+            encode_message(et, GlobalMetadata(version="0.0.4"))
+
+            encode_message(et, compute_node(1, (npu_id + 1) * compute_skew, []))
+            encode_message(et, all_reduce_node(2, coll_size, [1]))
+            encode_message(et, all_reduce_node(3, coll_size, [2]))
+
+if __name__ == "__main__":
+    main()
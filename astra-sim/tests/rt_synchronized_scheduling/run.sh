@@ -0,0 +1,49 @@
+#!/bin/bash
+set -e
+
+# Path
+SCRIPT_DIR=$(dirname "$(realpath $0)")
+ASTRA_SIM_BIN=${SCRIPT_DIR}/../../build/astra_analytical/build/bin/AstraSim_Analytical_Congestion_Aware
+
+# Runs with every rank scheduling its ready list on its own, and with all
+# ranks scheduling them in lockstep, each with its own system configuration
+MODES="unsynchronized synchronized"
+
+# Clear outputs
+(
+rm -rf ${SCRIPT_DIR}/outputs/*
+)
+
+# Generate inputs
+(
+echo "[$0] Generating inputs..."
+${SCRIPT_DIR}/inputs/workload/gen.sh
+)
+
+# Run ASTRA-sim once per mode
+for mode in ${MODES}; do
+(
+echo "[$0] Running ASTRA-sim (${mode})..."
+${ASTRA_SIM_BIN} \
+    --workload-configuration=${SCRIPT_DIR}/inputs/workload/chakra_trace \
+    --system-configuration=${SCRIPT_DIR}/inputs/system_cfg_${mode}.json \
+    --network-configuration=${SCRIPT_DIR}/inputs/network_cfg.yml \
+    --remote-memory-configuration=${SCRIPT_DIR}/inputs/remote_memory_cfg.json \
+	| tee ${SCRIPT_DIR}/outputs/stdout_${mode}.txt
+)
+done
+
+clean_log() {
+    sed -E 's/\[[^]]+\] //; s/\[[^]]+\] //; s/\[[^]]+\] //'
+}
+
+# Compare outputs
+for mode in ${MODES}; do
+(
+echo "[$0] Comparing outputs (${mode})..."
+clean_log < ${SCRIPT_DIR}/outputs/stdout_${mode}.txt > ${SCRIPT_DIR}/outputs/stdout_${mode}_clean.txt
+diff ${SCRIPT_DIR}/outputs/stdout_${mode}_clean.txt ${SCRIPT_DIR}/refs/stdout_${mode}.txt || (echo "Failed." ; exit 1)
+)
+done
+
+echo "[$0] Ok."
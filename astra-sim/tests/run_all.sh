@@ -9,4 +9,52 @@ echo "[$0] Running all regression tests..."
 echo "[$0] Running rt_template..."
 ${SCRIPT_DIR}/rt_template/run.sh || (echo "Failed." ; exit 1)
 
+echo "[$0] Running rt_shared_bus..."
+${SCRIPT_DIR}/rt_shared_bus/run.sh || (echo "Failed." ; exit 1)
+
+echo "[$0] Running rt_synchronized_scheduling..."
+${SCRIPT_DIR}/rt_synchronized_scheduling/run.sh || (echo "Failed." ; exit 1)
+
+echo "[$0] Running rt_fold_processing..."
+${SCRIPT_DIR}/rt_fold_processing/run.sh || (echo "Failed." ; exit 1)
+
+echo "[$0] Running rt_scheduling..."
+${SCRIPT_DIR}/rt_scheduling/run.sh || (echo "Failed." ; exit 1)
+
+echo "[$0] Running rt_rooted_collectives..."
+${SCRIPT_DIR}/rt_rooted_collectives/run.sh || (echo "Failed." ; exit 1)
+
+echo "[$0] Running rt_pipelined_tree..."
+${SCRIPT_DIR}/rt_pipelined_tree/run.sh || (echo "Failed." ; exit 1)
+
+echo "[$0] Running rt_bidirectional_collectives..."
+${SCRIPT_DIR}/rt_bidirectional_collectives/run.sh || (echo "Failed." ; exit 1)
+
+echo "[$0] Running rt_in_network_reduction..."
+${SCRIPT_DIR}/rt_in_network_reduction/run.sh || (echo "Failed." ; exit 1)
+
+echo "[$0] Running rt_collective_cost_cache..."
+${SCRIPT_DIR}/rt_collective_cost_cache/run.sh || (echo "Failed." ; exit 1)
+
+echo "[$0] Running rt_closed_form_collectives..."
+${SCRIPT_DIR}/rt_closed_form_collectives/run.sh || (echo "Failed." ; exit 1)
+
+echo "[$0] Running rt_graph_topology..."
+${SCRIPT_DIR}/rt_graph_topology/run.sh || (echo "Failed." ; exit 1)
+
+echo "[$0] Running rt_link_telemetry..."
+${SCRIPT_DIR}/rt_link_telemetry/run.sh || (echo "Failed." ; exit 1)
+
+echo "[$0] Running rt_link_overrides..."
+${SCRIPT_DIR}/rt_link_overrides/run.sh || (echo "Failed." ; exit 1)
+
+echo "[$0] Running rt_finite_buffers..."
+${SCRIPT_DIR}/rt_finite_buffers/run.sh || (echo "Failed." ; exit 1)
+
+echo "[$0] Running rt_unaware_contention..."
+${SCRIPT_DIR}/rt_unaware_contention/run.sh || (echo "Failed." ; exit 1)
+
+echo "[$0] Running rt_rank_placement..."
+${SCRIPT_DIR}/rt_rank_placement/run.sh || (echo "Failed." ; exit 1)
+
 echo "[$0] Finished all regression tests."
\ No newline at end of file